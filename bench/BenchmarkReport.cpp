@@ -0,0 +1,139 @@
+/*
+ * BenchmarkReport.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "bench/BenchmarkReport.h"
+#include "gslpp/error_handling/Error.h"
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <cstdlib>
+#include <map>
+
+namespace gslpp {
+namespace bench {
+
+BenchmarkRecord::BenchmarkRecord() : tolerance(0), evaluations(0), wallTime(0),
+		error(0), errorEstimate(0), budgetExhausted(false) {
+};
+
+void BenchmarkReport::print_header(std::ostream & os) {
+	os << std::left << std::setw(52) << "name" << std::right
+			<< std::setw(12) << "evaluations"
+			<< std::setw(14) << "time [s]"
+			<< std::setw(14) << "error"
+			<< std::setw(14) << "estimate" << "\n";
+}
+
+void BenchmarkReport::add(BenchmarkRecord const& record, std::ostream & os) {
+	_records.push_back(record);
+	os << std::left << std::setw(52) << record.name << std::right
+			<< std::setw(12) << record.evaluations
+			<< std::setw(14) << std::setprecision(3) << std::scientific << record.wallTime
+			<< std::setw(14) << record.error
+			<< std::setw(14) << record.errorEstimate
+			<< (record.budgetExhausted ? "  budget exhausted" : "") << std::defaultfloat << std::endl;
+}
+
+std::vector<BenchmarkRecord> const& BenchmarkReport::get_records() const {
+	return _records;
+}
+
+void BenchmarkReport::write_json(std::string const& fileName) const {
+	std::ofstream file(fileName.c_str());
+	if ( not file.good() )
+		error_handling::Error("Unable to open the file "+fileName+" for writing",error_handling::Error::FILE_IO_ERR);
+	file << "{\n\"benchmarks\": [\n" << std::setprecision(6) << std::scientific;
+	for ( size_t i = 0 ; i < _records.size(); ++i) {
+		BenchmarkRecord const& r = _records[i];
+		file << "{\"name\": \"" << r.name << "\""
+				<< ", \"tolerance\": " << r.tolerance
+				<< ", \"evaluations\": " << r.evaluations
+				<< ", \"wall_time\": " << r.wallTime
+				<< ", \"error\": " << r.error
+				<< ", \"error_estimate\": " << r.errorEstimate
+				<< ", \"budget_exhausted\": " << (r.budgetExhausted ? "true" : "false")
+				<< "}" << (i+1 < _records.size() ? "," : "") << "\n";
+	}
+	file << "]\n}\n";
+}
+
+namespace detail {
+//the text after "key": up to the next comma or closing brace
+std::string json_field(std::string const& line, std::string const& key) {
+	const std::string pattern = "\"" + key + "\": ";
+	size_t begin = line.find(pattern);
+	if ( begin == std::string::npos )
+		error_handling::Error("Missing field "+key+" in the benchmark record "+line,
+				error_handling::Error::INPUT_ERROR);
+	begin += pattern.size();
+	size_t end = line.find_first_of(",}",begin);
+	std::string value = line.substr(begin,end-begin);
+	if ( (value.size() >= 2) and (value[0] == '"') )
+		value = value.substr(1,value.size()-2);
+	return value;
+}
+} /* namespace detail */
+
+void BenchmarkReport::read_json(std::string const& fileName) {
+	std::ifstream file(fileName.c_str());
+	if ( not file.good() )
+		error_handling::Error("Unable to open the file "+fileName+" for reading",error_handling::Error::FILE_IO_ERR);
+	_records.clear();
+	std::string line;
+	while ( std::getline(file,line) ) {
+		if ( line.find("\"name\"") == std::string::npos )
+			continue;
+		BenchmarkRecord r;
+		r.name = detail::json_field(line,"name");
+		r.tolerance = std::atof(detail::json_field(line,"tolerance").c_str());
+		r.evaluations = std::strtoul(detail::json_field(line,"evaluations").c_str(),nullptr,10);
+		r.wallTime = std::atof(detail::json_field(line,"wall_time").c_str());
+		r.error = std::atof(detail::json_field(line,"error").c_str());
+		r.errorEstimate = std::atof(detail::json_field(line,"error_estimate").c_str());
+		r.budgetExhausted = (detail::json_field(line,"budget_exhausted") == "true");
+		_records.push_back(r);
+	}
+}
+
+size_t BenchmarkReport::compare_to_baseline(BenchmarkReport const& baseline,
+		double timeFactor,
+		std::ostream & os) const {
+	std::map<std::string,BenchmarkRecord const*> baselineByName;
+	for ( auto const& r : baseline.get_records() )
+		baselineByName[r.name] = &r;
+
+	size_t numRegressions = 0;
+	for ( auto const& r : _records ) {
+		auto it = baselineByName.find(r.name);
+		if ( it == baselineByName.end() ) {
+			os << "\tnot in the baseline: " << r.name << "\n";
+			continue;
+		}
+		BenchmarkRecord const& b = *(it->second);
+		baselineByName.erase(it);
+
+		std::ostringstream reasons;
+		if ( r.evaluations*10 > b.evaluations*11 )
+			reasons << " evaluations " << b.evaluations << " -> " << r.evaluations << ";";
+		//errors at the level of the rounding vary with the compiler
+		if ( (r.error > r.tolerance) and (r.error > 10*b.error) and (r.error > 1e-14) )
+			reasons << " error " << b.error << " -> " << r.error << ";";
+		if ( (timeFactor > 0) and (r.wallTime > 1e-3) and (r.wallTime > timeFactor*b.wallTime) )
+			reasons << " time " << b.wallTime << " -> " << r.wallTime << ";";
+		if ( not reasons.str().empty() ) {
+			os << "\tregression of " << r.name << ":" << reasons.str() << "\n";
+			++numRegressions;
+		}
+	}
+	for ( auto const& entry : baselineByName )
+		os << "\tonly in the baseline: " << entry.first << "\n";
+	return numRegressions;
+}
+
+} /* namespace bench */
+} /* namespace gslpp */
@@ -0,0 +1,107 @@
+/*
+ * BenchmarkReport.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef BENCH_BENCHMARKREPORT_H_
+#define BENCH_BENCHMARKREPORT_H_
+
+#include <vector>
+#include <string>
+#include <iosfwd>
+#include <cstddef>
+
+namespace gslpp {
+namespace bench {
+
+/**
+ * 	The measurement of a single benchmark.
+ */
+struct BenchmarkRecord {
+	BenchmarkRecord();
+
+	/**	A unique name, e.g. adaptive/gaussian/d2/double/tol1e-08 */
+	std::string name;
+
+	/**	The requested absolute accuracy, zero for rules without error control */
+	double tolerance;
+
+	/**	The number of evaluations of the integrand in a single integration */
+	size_t evaluations;
+
+	/**	The wall time of a single integration in seconds */
+	double wallTime;
+
+	/**	The largest absolute difference of a component to the exact integral */
+	double error;
+
+	/**	The largest component of the error estimate of the integrator */
+	double errorEstimate;
+
+	/**	True if the integrator stopped because the budget of evaluations was exhausted */
+	bool budgetExhausted;
+};
+
+/**
+ * 	A collection of benchmark records that are written as a table or as JSON and compared to a baseline.
+ *
+ * 	The JSON file has one record per line, such that it can be read back without a general parser
+ * 	and changes of a baseline are readable in a diff.
+ */
+class BenchmarkReport {
+public:
+
+	/**
+	 * Add a record and print it as a row of the table.
+	 *
+	 * @param record The measurement.
+	 * @param os The stream of the table.
+	 */
+	void add(BenchmarkRecord const& record, std::ostream & os);
+
+	/**	Print the header of the table */
+	static void print_header(std::ostream & os);
+
+	/**	@return The records in the order they were added */
+	std::vector<BenchmarkRecord> const& get_records() const;
+
+	/**
+	 * Write all records as JSON.
+	 *
+	 * @param fileName The name of the output file.
+	 */
+	void write_json(std::string const& fileName) const;
+
+	/**
+	 * Read records from a file written by write_json.
+	 *
+	 * @param fileName The name of the input file.
+	 */
+	void read_json(std::string const& fileName);
+
+	/**
+	 * Compare to a baseline and print every regression.
+	 *
+	 * A record regressed if it needs more than 10% more evaluations, if its error is above the
+	 * tolerance, above 1e-14 and more than ten times the baseline error, or if it takes more than timeFactor times
+	 * the baseline wall time. Times below a millisecond are not compared since they are dominated by noise.
+	 * Records that do not appear in both reports are listed but are not regressions.
+	 *
+	 * @param baseline The report of the baseline.
+	 * @param timeFactor The allowed ratio of the wall times. Zero does not compare times.
+	 * @param os The stream where the regressions are printed.
+	 * @return The number of regressions.
+	 */
+	size_t compare_to_baseline(BenchmarkReport const& baseline,
+			double timeFactor,
+			std::ostream & os) const;
+private:
+
+	std::vector<BenchmarkRecord> _records;
+};
+
+} /* namespace bench */
+} /* namespace gslpp */
+#endif /* BENCH_BENCHMARKREPORT_H_ */
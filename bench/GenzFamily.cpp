@@ -0,0 +1,139 @@
+/*
+ * GenzFamily.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "bench/GenzFamily.h"
+#include "gslpp/error_handling/Error.h"
+#include <random>
+#include <complex>
+#include <cmath>
+
+namespace gslpp {
+namespace bench {
+
+GenzFamily::GenzFamily(Type type, size_t dim, unsigned seed) : _type(type), _widths(dim), _shifts(dim) {
+	if ( dim == 0 )
+		error_handling::Error("The Genz functions need at least one dimension",error_handling::Error::INPUT_ERROR);
+
+	//the difficulties of the families as given by Genz
+	const double difficulty[numTypes] = { 9.0, 7.25, 1.85, 7.03, 20.4, 4.3 };
+	std::mt19937 generator(seed);
+	const double scale = 1.0/4294967296.0;
+	double sumOfWidths = 0;
+	for ( size_t i = 0 ; i < dim; ++i) {
+		_widths[i] = (double(generator()) + 0.5)*scale;
+		_shifts[i] = (double(generator()) + 0.5)*scale;
+		sumOfWidths += _widths[i];
+	}
+	for ( size_t i = 0 ; i < dim; ++i)
+		_widths[i] *= difficulty[type]/sumOfWidths;
+}
+
+double GenzFamily::value(double const * x) const {
+	const size_t d = _widths.size();
+	double result;
+	switch ( _type ) {
+	case OSCILLATORY:
+		result = 2.0*M_PI*_shifts[0];
+		for ( size_t i = 0 ; i < d; ++i)
+			result += _widths[i]*x[i];
+		return std::cos(result);
+	case PRODUCT_PEAK:
+		result = 1;
+		for ( size_t i = 0 ; i < d; ++i)
+			result /= 1.0/(_widths[i]*_widths[i]) + (x[i]-_shifts[i])*(x[i]-_shifts[i]);
+		return result;
+	case CORNER_PEAK:
+		result = 1;
+		for ( size_t i = 0 ; i < d; ++i)
+			result += _widths[i]*x[i];
+		return std::pow(result,-double(d+1));
+	case GAUSSIAN:
+		result = 0;
+		for ( size_t i = 0 ; i < d; ++i)
+			result -= _widths[i]*_widths[i]*(x[i]-_shifts[i])*(x[i]-_shifts[i]);
+		return std::exp(result);
+	case CONTINUOUS:
+		result = 0;
+		for ( size_t i = 0 ; i < d; ++i)
+			result -= _widths[i]*std::fabs(x[i]-_shifts[i]);
+		return std::exp(result);
+	case DISCONTINUOUS:
+		if ( (x[0] > _shifts[0]) or ((d > 1) and (x[1] > _shifts[1])) )
+			return 0;
+		result = 0;
+		for ( size_t i = 0 ; i < d; ++i)
+			result += _widths[i]*x[i];
+		return std::exp(result);
+	}
+	return 0;
+}
+
+double GenzFamily::exact_integral() const {
+	const size_t d = _widths.size();
+	double result = 1;
+	switch ( _type ) {
+	case OSCILLATORY: {
+		//the real part of exp(2 pi i u_1) prod_i (exp(i a_i)-1)/(i a_i)
+		std::complex<double> product = std::polar(1.0,2.0*M_PI*_shifts[0]);
+		for ( size_t i = 0 ; i < d; ++i)
+			product *= std::complex<double>(std::sin(_widths[i]),1.0-std::cos(_widths[i]))/_widths[i];
+		return product.real();
+	}
+	case PRODUCT_PEAK:
+		for ( size_t i = 0 ; i < d; ++i)
+			result *= _widths[i]*(std::atan(_widths[i]*(1.0-_shifts[i])) + std::atan(_widths[i]*_shifts[i]));
+		return result;
+	case CORNER_PEAK: {
+		//inclusion-exclusion over the corners of the cube
+		double sum = 0;
+		for ( size_t subset = 0 ; subset < (size_t(1) << d); ++subset) {
+			double denominator = 1;
+			double sign = 1;
+			for ( size_t i = 0 ; i < d; ++i)
+				if ( subset & (size_t(1) << i) ) {
+					denominator += _widths[i];
+					sign = -sign;
+				}
+			sum += sign/denominator;
+		}
+		for ( size_t i = 0 ; i < d; ++i)
+			result *= double(i+1)*_widths[i];
+		return sum/result;
+	}
+	case GAUSSIAN:
+		for ( size_t i = 0 ; i < d; ++i)
+			result *= std::sqrt(M_PI)/(2.0*_widths[i])*
+				(std::erf(_widths[i]*(1.0-_shifts[i])) + std::erf(_widths[i]*_shifts[i]));
+		return result;
+	case CONTINUOUS:
+		for ( size_t i = 0 ; i < d; ++i)
+			result *= (2.0 - std::exp(-_widths[i]*_shifts[i]) - std::exp(-_widths[i]*(1.0-_shifts[i])))/_widths[i];
+		return result;
+	case DISCONTINUOUS:
+		for ( size_t i = 0 ; i < d; ++i)
+			result *= std::expm1(_widths[i]*(i < 2 ? _shifts[i] : 1.0))/_widths[i];
+		return result;
+	}
+	return 0;
+}
+
+size_t GenzFamily::dim() const {
+	return _widths.size();
+}
+
+std::string GenzFamily::name() const {
+	return name(_type);
+}
+
+std::string GenzFamily::name(Type type) {
+	const char * names[numTypes] = { "oscillatory", "product_peak", "corner_peak",
+			"gaussian", "continuous", "discontinuous" };
+	return names[type];
+}
+
+} /* namespace bench */
+} /* namespace gslpp */
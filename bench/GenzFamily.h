@@ -0,0 +1,86 @@
+/*
+ * GenzFamily.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef BENCH_GENZFAMILY_H_
+#define BENCH_GENZFAMILY_H_
+
+#include <vector>
+#include <string>
+#include <cstddef>
+
+namespace gslpp {
+namespace bench {
+
+/**
+ * 	One member of the six test families of Genz on the unit cube \f$[0,1]^d\f$.
+ *
+ * 	The families are
+ * 		- OSCILLATORY \f$ \cos(2\pi u_1 + \sum_i a_i x_i) \f$
+ * 		- PRODUCT_PEAK \f$ \prod_i (a_i^{-2} + (x_i-u_i)^2)^{-1} \f$
+ * 		- CORNER_PEAK \f$ (1 + \sum_i a_i x_i)^{-(d+1)} \f$
+ * 		- GAUSSIAN \f$ \exp(-\sum_i a_i^2 (x_i-u_i)^2) \f$
+ * 		- CONTINUOUS \f$ \exp(-\sum_i a_i |x_i-u_i|) \f$
+ * 		- DISCONTINUOUS \f$ \exp(\sum_i a_i x_i) \f$ for \f$ x_1 \le u_1, x_2 \le u_2 \f$ and zero otherwise
+ *
+ * 	The shifts \f$ u_i \f$ are uniform in [0,1]. The widths \f$ a_i \f$ are uniform and scaled such that
+ * 	their sum is the difficulty of the family given by Genz. Both are drawn from the raw output of
+ * 	std::mt19937, which is the same for all standard libraries, such that a seed selects the same
+ * 	function everywhere. The integrals are known in closed form.
+ */
+class GenzFamily {
+public:
+
+	typedef enum {
+		OSCILLATORY = 0,
+		PRODUCT_PEAK = 1,
+		CORNER_PEAK = 2,
+		GAUSSIAN = 3,
+		CONTINUOUS = 4,
+		DISCONTINUOUS = 5
+	} Type;
+
+	/**	The number of families */
+	static const size_t numTypes = 6;
+
+	/**
+	 * Draw the parameters of a member of a family.
+	 *
+	 * @param type The family.
+	 * @param dim The dimension d. Must be at least 1.
+	 * @param seed The seed of the random parameters.
+	 */
+	GenzFamily(Type type, size_t dim, unsigned seed);
+
+	/**
+	 * @param x The d coordinates of the point in the unit cube.
+	 * @return The value of the function.
+	 */
+	double value(double const * x) const;
+
+	/**	@return The integral over the unit cube */
+	double exact_integral() const;
+
+	/**	@return The dimension d */
+	size_t dim() const;
+
+	/**	@return The name of the family in lower case */
+	std::string name() const;
+
+	/**	@return The name of a family in lower case */
+	static std::string name(Type type);
+private:
+
+	Type _type;
+
+	std::vector<double> _widths;
+
+	std::vector<double> _shifts;
+};
+
+} /* namespace bench */
+} /* namespace gslpp */
+#endif /* BENCH_GENZFAMILY_H_ */
@@ -0,0 +1,353 @@
+/*
+ * bench.cpp
+ *
+ *  Benchmark of the integrators on the test families of Genz.
+ *
+ *  Usage: bench.x [--quick] [--json output.json] [--baseline baseline.json] [--time-factor f]
+ *
+ *  Every benchmark reports the number of evaluations, the wall time and the achieved error of a single
+ *  integration. With --baseline the results are compared to a file written before with --json and the
+ *  program returns 1 if any benchmark regressed, see BenchmarkReport.compare_to_baseline. Wall times are
+ *  only compared if a time factor is given, since they depend on the machine.
+ *  --quick skips the three dimensional integrals.
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "bench/GenzFamily.h"
+#include "bench/BenchmarkReport.h"
+#include "gslpp/integration/Integrator.h"
+#include "gslpp/integration/IteratedIntegrator.h"
+#include "gslpp/auxillary/NumAccuracyControl.h"
+#include "gslpp/error_handling/Error.h"
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <array>
+#include <complex>
+#include <tuple>
+#include <chrono>
+#include <atomic>
+#include <limits>
+#include <cmath>
+#include <cstdlib>
+
+namespace gslpp {
+namespace bench {
+
+//a result with four components to measure container result types
+template<typename T>
+class ResultArray : public std::array<T,4> {
+public:
+	ResultArray() : std::array<T,4>{{0.0,0.0,0.0,0.0}} { };
+};
+
+template<typename T>
+ResultArray<T> operator+ (ResultArray<T> const& a, ResultArray<T> const& b) {
+	ResultArray<T> tmp;
+	for ( size_t i = 0 ; i < 4; ++i)
+		tmp[i] = a[i] + b[i];
+	return tmp;
+}
+
+template<typename T>
+ResultArray<T> operator* (ResultArray<T> const& a, T const& alpha) {
+	ResultArray<T> tmp;
+	for ( size_t i = 0 ; i < 4; ++i)
+		tmp[i] = a[i]*alpha;
+	return tmp;
+}
+
+//the result types are filled by the values of numComponents Genz functions with consecutive seeds
+template<typename R>
+struct result_traits { };
+
+template<>
+struct result_traits<double> {
+	typedef double argument_type;
+	static const size_t numComponents = 1;
+	static std::string name() {return "double";};
+	static double make(double const * values) {return values[0];};
+	static double threshold(double tolerance) {return tolerance;};
+	static double max_difference(double const& r, double const * reference) {return std::fabs(r-reference[0]);};
+};
+
+template<>
+struct result_traits<float> {
+	typedef float argument_type;
+	static const size_t numComponents = 1;
+	static std::string name() {return "float";};
+	static float make(double const * values) {return float(values[0]);};
+	static float threshold(double tolerance) {return float(tolerance);};
+	static double max_difference(float const& r, double const * reference) {return std::fabs(r-reference[0]);};
+};
+
+template<>
+struct result_traits< std::complex<double> > {
+	typedef double argument_type;
+	static const size_t numComponents = 2;
+	static std::string name() {return "complex";};
+	static std::complex<double> make(double const * values) {return std::complex<double>(values[0],values[1]);};
+	static std::complex<double> threshold(double tolerance) {return std::complex<double>(tolerance,tolerance);};
+	static double max_difference(std::complex<double> const& r, double const * reference) {
+		return std::max(std::fabs(r.real()-reference[0]),std::fabs(r.imag()-reference[1]));
+	};
+};
+
+template<>
+struct result_traits< ResultArray<double> > {
+	typedef double argument_type;
+	static const size_t numComponents = 4;
+	static std::string name() {return "array4";};
+	static ResultArray<double> make(double const * values) {
+		ResultArray<double> r;
+		for ( size_t i = 0 ; i < 4; ++i)
+			r[i] = values[i];
+		return r;
+	};
+	static ResultArray<double> threshold(double tolerance) {return make(std::array<double,4>{{
+			tolerance,tolerance,tolerance,tolerance}}.data());};
+	static double max_difference(ResultArray<double> const& r, double const * reference) {
+		double result = 0;
+		for ( size_t i = 0 ; i < 4; ++i)
+			result = std::max(result,std::fabs(r[i]-reference[i]));
+		return result;
+	};
+};
+
+//the Genz functions of the components that counts its evaluations
+template<typename R>
+class GenzIntegrand {
+public:
+	typedef result_traits<R> traits;
+
+	typedef typename traits::argument_type argument_type;
+
+	GenzIntegrand(GenzFamily::Type type, size_t dim, unsigned seed) : _numEvaluations(0) {
+		for ( size_t k = 0 ; k < traits::numComponents; ++k) {
+			_families.push_back(GenzFamily(type,dim,seed+unsigned(k)));
+			_exact[k] = _families.back().exact_integral();
+		}
+	};
+
+	R operator() (argument_type const * x) const {
+		++_numEvaluations;
+		double point[3];
+		for ( size_t i = 0 ; i < _families[0].dim(); ++i)
+			point[i] = x[i];
+		double values[traits::numComponents];
+		for ( size_t k = 0 ; k < traits::numComponents; ++k)
+			values[k] = _families[k].value(point);
+		return traits::make(values);
+	};
+
+	size_t dim() const {return _families[0].dim();};
+
+	double const * exact() const {return _exact;};
+
+	size_t num_evaluations() const {return _numEvaluations;};
+
+	void reset_num_evaluations() const {_numEvaluations = 0;};
+private:
+	std::vector<GenzFamily> _families;
+
+	double _exact[traits::numComponents];
+
+	mutable std::atomic<size_t> _numEvaluations;
+};
+
+//the number of evaluations of a one dimensional integral and of each level of an iterated integral
+size_t evaluation_budget(size_t dim) {
+	const size_t budget[3] = { 200000, 1500, 150 };
+	return budget[dim-1];
+}
+
+template<typename R>
+gslpp::auxillary::NumAccuracyControl<R> accuracy_control(double tolerance, size_t dim) {
+	//the refinement is driven by the global error only
+	gslpp::auxillary::NumAccuracyControl<R> acc;
+	const R zero = result_traits<R>::threshold(0);
+	acc.set_local_error_threshold(zero,zero);
+	acc.set_global_error_threshold(zero,result_traits<R>::threshold(tolerance));
+	acc.set_max_num_evaluations(evaluation_budget(dim));
+	return acc;
+}
+
+template<typename R>
+void integrate_adaptive(GenzIntegrand<R> const& integrand, double tolerance,
+		R &integral, gslpp::auxillary::NumAccuracyControl<R> &acc) {
+	typedef typename GenzIntegrand<R>::argument_type A;
+	const size_t dim = integrand.dim();
+	//the inner integrals are accurate beyond the tolerance, since their errors add up in the outer integral
+	gslpp::auxillary::NumAccuracyControl<R> innerAcc = accuracy_control<R>(tolerance*1e-2,dim);
+	if ( dim == 1 ) {
+		auto f = [&]( A x ){ return integrand(&x); };
+		gslpp::integration::Integrator< decltype(f) > integrator;
+		integrator.integrate(A(0),A(1),f,integral,acc);
+	} else if ( dim == 2 ) {
+		auto f = [&]( A x, A y ){
+			A point[2] = { x, y };
+			return integrand(point);
+		};
+		gslpp::integration::IteratedIntegrator< decltype(f), 0, 1 > integrator;
+		integrator.set_num_threads(1);
+		integrator.set_accuracy_control(1,innerAcc);
+		integrator.integrate(std::make_tuple(A(0),A(0)),std::make_tuple(A(1),A(1)),f,integral,acc);
+	} else {
+		auto f = [&]( A x, A y, A z ){
+			A point[3] = { x, y, z };
+			return integrand(point);
+		};
+		gslpp::integration::IteratedIntegrator< decltype(f), 0, 1, 2 > integrator;
+		integrator.set_num_threads(1);
+		integrator.set_accuracy_control(1,innerAcc);
+		integrator.set_accuracy_control(2,innerAcc);
+		integrator.integrate(std::make_tuple(A(0),A(0),A(0)),std::make_tuple(A(1),A(1),A(1)),f,integral,acc);
+	}
+}
+
+//run once to count the evaluations, repeat short runs for the time
+template<class Run>
+double wall_time_of(Run const& run) {
+	typedef std::chrono::steady_clock clock;
+	clock::time_point start = clock::now();
+	run();
+	double first = std::chrono::duration<double>(clock::now()-start).count();
+	if ( first > 0.05 )
+		return first;
+	size_t numRuns = 0;
+	start = clock::now();
+	double total = 0;
+	do {
+		run();
+		++numRuns;
+		total = std::chrono::duration<double>(clock::now()-start).count();
+	} while ( total < 0.05 );
+	return total/double(numRuns);
+}
+
+std::string format_tolerance(double tolerance) {
+	std::ostringstream os;
+	os << std::setprecision(0) << std::scientific << tolerance;
+	return os.str();
+}
+
+template<typename R>
+void run_adaptive(GenzFamily::Type type, size_t dim, double tolerance, BenchmarkReport &report) {
+	typedef result_traits<R> traits;
+	GenzIntegrand<R> integrand(type,dim,unsigned(1000*dim + type));
+	R integral = traits::threshold(0);
+	gslpp::auxillary::NumAccuracyControl<R> acc;
+	auto run = [&](){
+		integrand.reset_num_evaluations();
+		acc = accuracy_control<R>(tolerance,dim);
+		integrate_adaptive(integrand,tolerance,integral,acc);
+	};
+
+	BenchmarkRecord record;
+	record.name = "adaptive/" + GenzFamily::name(type) + "/d" + std::to_string(dim)
+			+ "/" + traits::name() + "/tol" + format_tolerance(tolerance);
+	record.tolerance = tolerance;
+	record.wallTime = wall_time_of(run);
+	record.evaluations = integrand.num_evaluations();
+	record.error = traits::max_difference(integral,integrand.exact());
+	const double zero[traits::numComponents] = { };
+	record.errorEstimate = traits::max_difference(acc.get_abs_error_estimate(),zero);
+	record.budgetExhausted = acc.budget_exhausted();
+	report.add(record,std::cout);
+}
+
+template<typename R>
+void run_fixed(GenzFamily::Type type, size_t numSegments, BenchmarkReport &report) {
+	typedef result_traits<R> traits;
+	typedef typename GenzIntegrand<R>::argument_type A;
+	GenzIntegrand<R> integrand(type,1,unsigned(1000 + type));
+	auto f = [&]( A x ){ return integrand(&x); };
+	gslpp::integration::Integrator< decltype(f) > integrator;
+	std::vector<A> segmentPoints(numSegments+1);
+	for ( size_t i = 0 ; i <= numSegments; ++i)
+		segmentPoints[i] = A(i)/A(numSegments);
+	R integral = traits::threshold(0);
+	R errorEstimate = traits::threshold(0);
+	auto run = [&](){
+		integrand.reset_num_evaluations();
+		integrator.non_adaptive_integral(segmentPoints,f,integral,errorEstimate);
+	};
+
+	BenchmarkRecord record;
+	record.name = "fixed/" + GenzFamily::name(type) + "/d1/" + traits::name() + "/seg" + std::to_string(numSegments);
+	record.wallTime = wall_time_of(run);
+	record.evaluations = integrand.num_evaluations();
+	record.error = traits::max_difference(integral,integrand.exact());
+	const double zero[traits::numComponents] = { };
+	record.errorEstimate = traits::max_difference(errorEstimate,zero);
+	report.add(record,std::cout);
+}
+
+template<typename R>
+void run_result_type(size_t maxDim, BenchmarkReport &report) {
+	typedef typename GenzIntegrand<R>::argument_type A;
+	const double tolerances[3] = { 1e-4, 1e-8, 1e-12 };
+	for ( size_t t = 0 ; t < GenzFamily::numTypes; ++t) {
+		GenzFamily::Type type = GenzFamily::Type(t);
+		for ( size_t dim = 1 ; dim <= maxDim; ++dim)
+			for ( double tolerance : tolerances ) {
+				//tolerances close to the rounding are not reachable, and the iterated integrals
+				//	are too expensive for the tightest tolerance
+				if ( (tolerance < 100*std::numeric_limits<A>::epsilon()) or ((dim > 1) and (tolerance < 1e-10)) )
+					continue;
+				run_adaptive<R>(type,dim,tolerance,report);
+			}
+		run_fixed<R>(type,16,report);
+		run_fixed<R>(type,256,report);
+	}
+}
+
+} /* namespace bench */
+} /* namespace gslpp */
+
+int main (int argc, char *argv[]){
+	using namespace gslpp::bench;
+	std::string jsonFileName, baselineFileName;
+	double timeFactor = 0;
+	size_t maxDim = 3;
+	for ( int i = 1 ; i < argc; ++i) {
+		const std::string arg = argv[i];
+		if ( arg == "--quick" ) {
+			maxDim = 2;
+		} else if ( (arg == "--json") and (i+1 < argc) ) {
+			jsonFileName = argv[++i];
+		} else if ( (arg == "--baseline") and (i+1 < argc) ) {
+			baselineFileName = argv[++i];
+		} else if ( (arg == "--time-factor") and (i+1 < argc) ) {
+			timeFactor = std::atof(argv[++i]);
+		} else {
+			gslpp::error_handling::Error("Unknown argument "+arg+". Usage: bench.x [--quick] [--json output.json] "
+					"[--baseline baseline.json] [--time-factor f]",gslpp::error_handling::Error::INPUT_ERROR);
+		}
+	}
+
+	BenchmarkReport report;
+	BenchmarkReport::print_header(std::cout);
+	run_result_type<double>(maxDim,report);
+	run_result_type<float>(maxDim,report);
+	run_result_type< std::complex<double> >(maxDim,report);
+	run_result_type< ResultArray<double> >(maxDim,report);
+
+	if ( not jsonFileName.empty() )
+		report.write_json(jsonFileName);
+
+	if ( not baselineFileName.empty() ) {
+		BenchmarkReport baseline;
+		baseline.read_json(baselineFileName);
+		std::cout << "\nComparison to the baseline " << baselineFileName << ":" << std::endl;
+		const size_t numRegressions = report.compare_to_baseline(baseline,timeFactor,std::cout);
+		std::cout << numRegressions << " regressions" << std::endl;
+		if ( numRegressions > 0 )
+			return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,67 @@
+/*
+ * AlignedAllocator.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_AUXILLARY_ALIGNEDALLOCATOR_H_
+#define GSLPP_AUXILLARY_ALIGNEDALLOCATOR_H_
+
+#include <cstddef>
+
+namespace gslpp {
+namespace auxillary {
+
+/**
+ * 	An allocator for standard containers that places the storage at a multiple of alignment bytes.
+ *
+ * 	With the default of 64 bytes an array starts at a cache line, such that vector loads from
+ * 	the beginning of the array do not cross cache lines.
+ * 	The alignment must be a power of two and a multiple of sizeof(void*).
+ */
+template<typename T, size_t alignment = 64>
+class AlignedAllocator {
+	static_assert((alignment & (alignment-1)) == 0, "The alignment must be a power of two");
+	static_assert(alignment % sizeof(void*) == 0, "The alignment must be a multiple of the pointer size");
+public:
+	typedef T value_type;
+
+	template<typename U>
+	struct rebind {
+		typedef AlignedAllocator<U,alignment> other;
+	};
+
+	AlignedAllocator();
+
+	template<typename U>
+	AlignedAllocator(AlignedAllocator<U,alignment> const&);
+
+	/**
+	 * Allocate aligned storage.
+	 *
+	 * @param n The number of elements.
+	 * @return A pointer to uninitialized storage for n elements. Throws std::bad_alloc on failure.
+	 */
+	T * allocate(size_t n);
+
+	/**
+	 * Release storage obtained from AlignedAllocator.allocate.
+	 *
+	 * @param p The pointer to the storage.
+	 * @param n The number of elements.
+	 */
+	void deallocate(T * p, size_t n);
+};
+
+template<typename T, typename U, size_t alignment>
+bool operator== (AlignedAllocator<T,alignment> const&, AlignedAllocator<U,alignment> const&);
+
+template<typename T, typename U, size_t alignment>
+bool operator!= (AlignedAllocator<T,alignment> const&, AlignedAllocator<U,alignment> const&);
+
+} /* namespace auxillary */
+} /* namespace gslpp */
+
+#include "gslpp/auxillary/src/AlignedAllocator.hpp"
+#endif /* GSLPP_AUXILLARY_ALIGNEDALLOCATOR_H_ */
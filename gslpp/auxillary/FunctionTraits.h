@@ -8,6 +8,7 @@
 #ifndef GSLPP_AUXILLARY_FUNCTIONTRAITS_H_
 #define GSLPP_AUXILLARY_FUNCTIONTRAITS_H_
 
+#include <cstddef>
 #include <tuple>
 #include <type_traits>
 
@@ -0,0 +1,86 @@
+/*
+ * MappedArray.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_AUXILLARY_MAPPEDARRAY_H_
+#define GSLPP_AUXILLARY_MAPPEDARRAY_H_
+
+#include <string>
+#include <cstddef>
+#include <type_traits>
+
+namespace gslpp {
+namespace auxillary {
+
+/**
+ * 	A read only view of a binary file of numbers of type T that is mapped into memory.
+ *
+ * 	The operating system loads the pages on access and may drop them again, such that
+ * 	files larger than the main memory can be processed sequentially. The numbers are
+ * 	expected in the native byte order. The mapping is released on destruction.
+ */
+template<typename T>
+class MappedArray {
+	static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable types can be mapped from a file");
+public:
+
+	/**
+	 * Map a file read only.
+	 *
+	 * @param fileName The name of the file.
+	 * @param byteOffset The number of bytes at the beginning of the file that are skipped, e.g. a header.
+	 * 			Need not be a multiple of the page size, but the data must be aligned for T.
+	 */
+	explicit MappedArray(std::string const& fileName, size_t byteOffset = 0);
+
+	~MappedArray();
+
+	MappedArray(MappedArray const&) = delete;
+
+	MappedArray & operator= (MappedArray const&) = delete;
+
+	/**	@return A pointer to the first number */
+	T const * data() const;
+
+	/**	@return The number of complete numbers of type T in the file after the offset */
+	size_t size() const;
+
+	/**	@return The number i of the array */
+	T const& operator[] (size_t i) const;
+
+	/**
+	 * Tell the operating system that a range of the array is not needed any more.
+	 *
+	 * The pages are dropped from memory and read again from the file on a later access.
+	 * Use this after a range has been processed in a sequential pass over a large file.
+	 *
+	 * @param begin The index of the first number of the range.
+	 * @param end The index behind the last number of the range.
+	 */
+	void release_range(size_t begin, size_t end) const;
+
+	/**
+	 * Tell the operating system that the array is accessed at random positions, e.g. for a table lookup.
+	 *
+	 * This disables the read ahead of pages that is set up for a sequential pass upon construction.
+	 */
+	void advise_random_access() const;
+private:
+
+	void * _mapping;
+
+	size_t _mappingLength;
+
+	T const * _data;
+
+	size_t _size;
+};
+
+} /* namespace auxillary */
+} /* namespace gslpp */
+
+#include "gslpp/auxillary/src/MappedArray.hpp"
+#endif /* GSLPP_AUXILLARY_MAPPEDARRAY_H_ */
@@ -10,6 +10,8 @@
 
 #include "gslpp/auxillary/has_iterator.h"
 #include <cstddef>
+#include <chrono>
+#include <atomic>
 
 namespace gslpp {
 namespace auxillary {
@@ -30,6 +32,10 @@ class NumAccuracyControl_impl;
  * 	 with (all elements of) the relative error threshold. The result is compared with the estimate for
  * 	 the relative error.
  * 	The criteria of convergence is that all elements are converged.
+ * 	In addition, the computational budget of an algorithm can be limited by a maximal number of
+ * 	 function evaluations, a wall-clock deadline and a cancellation token. An algorithm that stops
+ * 	 because the budget is exhausted returns its best current estimate and signals this
+ * 	 via NumAccuracyControl.budget_exhausted().
  */
 template<typename T>
 class NumAccuracyControl : public NumAccuracyControl_impl<NumAccuracyControl<T>, T, has_iterator<T>::value > {
@@ -155,6 +161,55 @@ public:
 	 * @return The relative error estimate.
 	 */
 	T get_rel_error_estimate() const;
+
+	/**
+	 * Set the maximal number of function evaluations.
+	 *
+	 * @param n The maximal number of evaluations. Zero means no limit.
+	 */
+	void set_max_num_evaluations(size_t n);
+
+	/**
+	 * @return The maximal number of function evaluations. Zero means no limit.
+	 */
+	size_t get_max_num_evaluations() const;
+
+	/**
+	 * Set the point in time after which no further work should be started.
+	 *
+	 * @param deadline The wall-clock deadline.
+	 */
+	void set_deadline(std::chrono::steady_clock::time_point deadline);
+
+	/**
+	 * Set a flag that signals cancellation if it becomes true.
+	 *
+	 * The token is not owned and must outlive the use of this object. A null pointer removes the token.
+	 *
+	 * @param cancellationToken Pointer to the flag.
+	 */
+	void set_cancellation_token(std::atomic<bool> const* cancellationToken);
+
+	/**
+	 * Check if the budget allows to continue.
+	 *
+	 * @param numEvaluations The total number of evaluations including the ones that are about to be done.
+	 * @return False if numEvaluations exceeds the maximal number of evaluations, the deadline has passed
+	 * 			or cancellation was requested. True otherwise.
+	 */
+	bool budget_allows(size_t numEvaluations) const;
+
+	/**
+	 * Tell the object if an algorithm stopped because the budget was exhausted.
+	 *
+	 * @param exhausted True if the budget was exhausted.
+	 */
+	void set_budget_exhausted(bool exhausted);
+
+	/**
+	 * @return True if the last algorithm using this object stopped because the budget was exhausted.
+	 */
+	bool budget_exhausted() const;
 private:
 
 	bool _checkAbsLocal;
@@ -174,6 +229,11 @@ private:
 	size_t _subdivisions;
 	size_t _maxNumberOfSubdivisions;
 
+	size_t _maxNumberOfEvaluations;
+	std::chrono::steady_clock::time_point _deadline;
+	std::atomic<bool> const* _cancellationToken;
+	bool _budgetExhausted;
+
 };
 
 } /* namespace auxillary */
@@ -0,0 +1,59 @@
+/*
+ * ParallelRanges.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_AUXILLARY_PARALLELRANGES_H_
+#define GSLPP_AUXILLARY_PARALLELRANGES_H_
+
+#include <cstddef>
+
+namespace gslpp {
+namespace auxillary {
+
+/**	The smallest number of items for which an additional thread pays off by default */
+constexpr size_t minItemsPerThread = size_t(1) << 16;
+
+/**
+ * The number of threads for a loop over a number of items.
+ *
+ * @param maxThreads The largest number of threads. Zero is taken as one.
+ * @param numItems The number of items.
+ * @param minItems The smallest number of items per thread.
+ * @return The number of threads between 1 and maxThreads, such that each has at least minItems items.
+ */
+size_t num_threads_for_items(size_t maxThreads, size_t numItems, size_t minItems = minItemsPerThread);
+
+/**
+ * The beginning of a range if [begin,end) is split into contiguous ranges of nearly equal size.
+ *
+ * @param begin The first item.
+ * @param end The item behind the last one.
+ * @param numRanges The number of ranges.
+ * @param i The index of the range. With i = numRanges, this is end.
+ * @return The first item of range i.
+ */
+size_t range_begin(size_t begin, size_t end, size_t numRanges, size_t i);
+
+/**
+ * Split [begin,end) into contiguous ranges of nearly equal size and process each in its own thread.
+ *
+ * The first range is processed in the calling thread and the others in new threads, which are joined before
+ * the function returns. An exception thrown while processing a range is passed on to the calling thread after
+ * all threads are joined. If several ranges throw, the exception of the first of them is passed on.
+ *
+ * @param begin The first item.
+ * @param end The item behind the last one.
+ * @param numRanges The number of ranges and threads. Zero is taken as one.
+ * @param f Called as f(i,rangeBegin,rangeEnd) for the range i. Must be safe to call concurrently.
+ */
+template<class Function>
+void for_each_range_in_parallel(size_t begin, size_t end, size_t numRanges, Function const& f);
+
+} /* namespace auxillary */
+} /* namespace gslpp */
+
+#include "gslpp/auxillary/src/ParallelRanges.hpp"
+#endif /* GSLPP_AUXILLARY_PARALLELRANGES_H_ */
@@ -35,13 +35,10 @@ private:
 	struct Fallback { typedef void value_type;};
 	struct Derived : T, Fallback {};
 
-	template<typename C, C>
-	struct ChT;
-
-	//The following will work only, if T does not define the iterator type, otherwise
+	//The following will work only, if T does not define the value_type, otherwise
 	//	this will result in an ambiguity and the second version of check will be chosen
     template <typename U>
-    static constexpr std::false_type check( decltype(U::value_type) *);
+    static constexpr std::false_type check( typename U::value_type *);
 
     template <typename U>
     static constexpr std::true_type check(...);
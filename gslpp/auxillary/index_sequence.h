@@ -0,0 +1,67 @@
+/*
+ * index_sequence.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_AUXILLARY_INDEX_SEQUENCE_H_
+#define GSLPP_AUXILLARY_INDEX_SEQUENCE_H_
+/** \file index_sequence.h
+    \brief A compile time sequence of indices as std::index_sequence which is not part of C++11.
+*/
+
+#include <cstddef>
+
+namespace gslpp{
+namespace auxillary{
+
+/**
+ * A compile time sequence of indices.
+ */
+template<size_t ... indices>
+struct index_sequence {
+	static const size_t size = sizeof...(indices);
+};
+
+/// @cond Doxygen_suppress
+template<size_t N, size_t ... indices>
+struct make_index_sequence_impl : make_index_sequence_impl<N-1, N-1, indices...> { };
+
+template<size_t ... indices>
+struct make_index_sequence_impl<0, indices...> {
+	typedef index_sequence<indices...> type;
+};
+/// @endcond
+
+/**
+ * gslpp::auxillary::make_index_sequence<N>::type is the index_sequence<0, 1, ..., N-1>.
+ */
+template<size_t N>
+struct make_index_sequence : make_index_sequence_impl<N> { };
+
+/// @cond Doxygen_suppress
+template<size_t i, size_t first, size_t ... rest>
+struct index_sequence_element_impl : index_sequence_element_impl<i-1, rest...> { };
+
+template<size_t first, size_t ... rest>
+struct index_sequence_element_impl<0, first, rest...> {
+	static const size_t value = first;
+};
+/// @endcond
+
+/**
+ * gslpp::auxillary::index_sequence_element<i,Sequence>::value is the element number i of the index_sequence Sequence.
+ */
+template<size_t i, class Sequence>
+struct index_sequence_element;
+
+template<size_t i, size_t ... indices>
+struct index_sequence_element<i, index_sequence<indices...> > : index_sequence_element_impl<i, indices...> {
+	static_assert( i < sizeof...(indices), "Index must be < the length of the sequence!");
+};
+
+}
+}
+
+#endif /* GSLPP_AUXILLARY_INDEX_SEQUENCE_H_ */
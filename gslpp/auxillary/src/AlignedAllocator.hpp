@@ -0,0 +1,51 @@
+/*
+ * AlignedAllocator.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/auxillary/AlignedAllocator.h"
+#include <cstdlib>
+#include <new>
+#include <limits>
+
+namespace gslpp {
+namespace auxillary {
+
+template<typename T, size_t alignment>
+AlignedAllocator<T,alignment>::AlignedAllocator() {
+}
+
+template<typename T, size_t alignment>
+template<typename U>
+AlignedAllocator<T,alignment>::AlignedAllocator(AlignedAllocator<U,alignment> const&) {
+}
+
+template<typename T, size_t alignment>
+T * AlignedAllocator<T,alignment>::allocate(size_t n) {
+	if ( n > std::numeric_limits<size_t>::max()/sizeof(T) )
+		throw std::bad_alloc();
+	void * p = nullptr;
+	if ( posix_memalign(&p,alignment,n*sizeof(T)) != 0 )
+		throw std::bad_alloc();
+	return static_cast<T*>(p);
+}
+
+template<typename T, size_t alignment>
+void AlignedAllocator<T,alignment>::deallocate(T * p, size_t n) {
+	std::free(p);
+}
+
+template<typename T, typename U, size_t alignment>
+bool operator== (AlignedAllocator<T,alignment> const&, AlignedAllocator<U,alignment> const&) {
+	return true;
+}
+
+template<typename T, typename U, size_t alignment>
+bool operator!= (AlignedAllocator<T,alignment> const&, AlignedAllocator<U,alignment> const&) {
+	return false;
+}
+
+} /* namespace auxillary */
+} /* namespace gslpp */
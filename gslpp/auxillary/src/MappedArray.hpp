@@ -0,0 +1,104 @@
+/*
+ * MappedArray.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/auxillary/MappedArray.h"
+#include "gslpp/error_handling/Error.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cstdint>
+#include <algorithm>
+
+namespace gslpp {
+namespace auxillary {
+
+template<typename T>
+MappedArray<T>::MappedArray(std::string const& fileName, size_t byteOffset) :
+	_mapping(0), _mappingLength(0), _data(0), _size(0) {
+	const int fileDescriptor = open(fileName.c_str(),O_RDONLY);
+	if ( fileDescriptor < 0 )
+		gslpp::error_handling::Error( "Unable to open the file "+fileName+" for mapping",
+				gslpp::error_handling::Error::FILE_IO_ERR);
+	struct stat fileStatus;
+	if ( fstat(fileDescriptor,&fileStatus) != 0 ) {
+		close(fileDescriptor);
+		gslpp::error_handling::Error( "Unable to determine the size of the file "+fileName,
+				gslpp::error_handling::Error::FILE_IO_ERR);
+	}
+	const size_t fileSize = static_cast<size_t>(fileStatus.st_size);
+	if ( byteOffset > fileSize ) {
+		close(fileDescriptor);
+		gslpp::error_handling::Error( "The offset is behind the end of the file "+fileName,
+				gslpp::error_handling::Error::INPUT_ERROR);
+	}
+
+	_size = (fileSize-byteOffset)/sizeof(T);
+	if ( fileSize > 0 ) {
+		_mappingLength = fileSize;
+		_mapping = mmap(0,_mappingLength,PROT_READ,MAP_SHARED,fileDescriptor,0);
+		if ( _mapping == MAP_FAILED ) {
+			_mapping = 0;
+			close(fileDescriptor);
+			gslpp::error_handling::Error( "Unable to map the file "+fileName,
+					gslpp::error_handling::Error::FILE_IO_ERR);
+		}
+		madvise(_mapping,_mappingLength,MADV_SEQUENTIAL);
+		_data = reinterpret_cast<T const *>(static_cast<char const *>(_mapping) + byteOffset);
+	}
+	//the mapping stays valid after the file is closed
+	close(fileDescriptor);
+}
+
+template<typename T>
+MappedArray<T>::~MappedArray() {
+	if ( _mapping != 0 )
+		munmap(_mapping,_mappingLength);
+}
+
+template<typename T>
+T const * MappedArray<T>::data() const {
+	return _data;
+}
+
+template<typename T>
+size_t MappedArray<T>::size() const {
+	return _size;
+}
+
+template<typename T>
+T const& MappedArray<T>::operator[] (size_t i) const {
+#ifdef DEBUG_BUILD
+	if ( i >= _size )
+		gslpp::error_handling::Error( "Access of the mapped array out of bounds",
+				gslpp::error_handling::Error::OUT_OF_BOUNDS);
+#endif
+	return _data[i];
+}
+
+template<typename T>
+void MappedArray<T>::release_range(size_t begin, size_t end) const {
+	if ( (_mapping == 0) or (begin >= end) )
+		return;
+	//only whole pages inside the range can be released
+	const uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+	const uintptr_t first = reinterpret_cast<uintptr_t>(_data + begin);
+	const uintptr_t last = reinterpret_cast<uintptr_t>(_data + std::min(end,_size));
+	const uintptr_t firstPage = ((first + pageSize - 1)/pageSize)*pageSize;
+	const uintptr_t lastPage = (last/pageSize)*pageSize;
+	if ( lastPage > firstPage )
+		madvise(reinterpret_cast<void *>(firstPage),lastPage-firstPage,MADV_DONTNEED);
+}
+
+template<typename T>
+void MappedArray<T>::advise_random_access() const {
+	if ( _mapping != 0 )
+		madvise(_mapping,_mappingLength,MADV_RANDOM);
+}
+
+} /* namespace auxillary */
+} /* namespace gslpp */
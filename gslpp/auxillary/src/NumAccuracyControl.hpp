@@ -76,7 +76,9 @@ struct cmp_leq_abs<std::complex<T> >{
 template<typename T>
 class NumAccuracyControl_impl< NumAccuracyControl<T>, T,false> {
 public:
-	NumAccuracyControl_impl() {
+	//Called from the constructor of NumAccuracyControl once its members exist. Setting the thresholds
+	//	in the constructor of this base would be undone by the default constructor of T for class types.
+	void set_default_thresholds() {
 		T localRelativeErrorThreshold = ( AccuracyGoal<T>::value );
 		T localAbsErrorThreshold = (  AccuracyGoal<T>::value );
 		T globalRelativeErrorThreshold =(   AccuracyGoal<T>::value );
@@ -109,11 +111,13 @@ public:
 template<typename T>
 class NumAccuracyControl_impl< NumAccuracyControl< std::complex<T> >, std::complex<T>,false> {
 public:
-	NumAccuracyControl_impl() {
-		std::complex<T> localRelativeErrorThreshold = ( AccuracyGoal<T>::value );
-		std::complex<T> localAbsErrorThreshold = (  AccuracyGoal<T>::value );
-		std::complex<T> globalRelativeErrorThreshold =(   AccuracyGoal<T>::value );
-		std::complex<T> globalAbsErrorThreshold = (  AccuracyGoal<T>::value );
+	void set_default_thresholds() {
+		//the comparison is component wise, thus the imaginary part needs the threshold as well
+		const std::complex<T> goal( AccuracyGoal<T>::value, AccuracyGoal<T>::value );
+		std::complex<T> localRelativeErrorThreshold = goal;
+		std::complex<T> localAbsErrorThreshold = goal;
+		std::complex<T> globalRelativeErrorThreshold = goal;
+		std::complex<T> globalAbsErrorThreshold = goal;
 		static_cast<NumAccuracyControl<std::complex<T> >*>(this)->set_local_error_threshold(localRelativeErrorThreshold,localAbsErrorThreshold);
 		static_cast<NumAccuracyControl<std::complex<T> >*>(this)->set_global_error_threshold(globalRelativeErrorThreshold,globalAbsErrorThreshold);
 	}
@@ -145,6 +149,8 @@ public:
 
 	typedef typename std::iterator_traits<typename T::iterator>::value_type value_type;
 
+	void set_default_thresholds() { };
+
 	bool abs_first_leq_than_second_impl(T first, T second) const {
 		T diff = first + second * value_type(-1.0);
 		return std::any_of(diff.begin(), diff.end(),
@@ -179,6 +185,11 @@ public:
 template<typename T>
 NumAccuracyControl<T>::NumAccuracyControl() : NumAccuracyControl_impl<NumAccuracyControl<T>,T,has_iterator<T>::value >(){
 	 _maxNumberOfSubdivisions =1000;
+	 _maxNumberOfEvaluations = 0;
+	 _deadline = std::chrono::steady_clock::time_point::max();
+	 _cancellationToken = nullptr;
+	 _budgetExhausted = false;
+	 this->set_default_thresholds();
 }
 
 template<typename T>
@@ -258,5 +269,47 @@ T NumAccuracyControl<T>::get_rel_error_estimate() const{
 	return _errorEstimateRel;
 }
 
+template<typename T>
+void NumAccuracyControl<T>::set_max_num_evaluations(size_t n){
+	_maxNumberOfEvaluations = n;
+}
+
+template<typename T>
+size_t NumAccuracyControl<T>::get_max_num_evaluations() const {
+	return _maxNumberOfEvaluations;
+}
+
+template<typename T>
+void NumAccuracyControl<T>::set_deadline(std::chrono::steady_clock::time_point deadline){
+	_deadline = deadline;
+}
+
+template<typename T>
+void NumAccuracyControl<T>::set_cancellation_token(std::atomic<bool> const* cancellationToken){
+	_cancellationToken = cancellationToken;
+}
+
+template<typename T>
+bool NumAccuracyControl<T>::budget_allows(size_t numEvaluations) const {
+	if ( (_maxNumberOfEvaluations != 0) and (numEvaluations > _maxNumberOfEvaluations) )
+		return false;
+	if ( (_cancellationToken != nullptr) and _cancellationToken->load(std::memory_order_relaxed) )
+		return false;
+	//only query the clock if a deadline is set
+	if ( _deadline != std::chrono::steady_clock::time_point::max() )
+		return std::chrono::steady_clock::now() < _deadline;
+	return true;
+}
+
+template<typename T>
+void NumAccuracyControl<T>::set_budget_exhausted(bool exhausted){
+	_budgetExhausted = exhausted;
+}
+
+template<typename T>
+bool NumAccuracyControl<T>::budget_exhausted() const {
+	return _budgetExhausted;
+}
+
 } /* namespace auxillary */
 } /* namespace gslpp */
@@ -0,0 +1,55 @@
+/*
+ * ParallelRanges.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/auxillary/ParallelRanges.h"
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace gslpp {
+namespace auxillary {
+
+inline size_t num_threads_for_items(size_t maxThreads, size_t numItems, size_t minItems) {
+	return std::max(size_t(1),std::min(maxThreads,numItems/std::max(minItems,size_t(1))));
+}
+
+inline size_t range_begin(size_t begin, size_t end, size_t numRanges, size_t i) {
+	return begin + (i*(end-begin))/numRanges;
+}
+
+template<class Function>
+void for_each_range_in_parallel(size_t begin, size_t end, size_t numRanges, Function const& f) {
+	if ( numRanges <= 1 ) {
+		f(size_t(0),begin,end);
+		return;
+	}
+
+	std::vector<std::exception_ptr> exceptions(numRanges);
+	auto process_range = [&] (size_t i) {
+		try {
+			f(i,range_begin(begin,end,numRanges,i),range_begin(begin,end,numRanges,i+1));
+		} catch (...) {
+			exceptions[i] = std::current_exception();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(numRanges-1);
+	for ( size_t i = 1 ; i < numRanges; ++i)
+		threads.push_back(std::thread(process_range,i));
+	process_range(0);
+	for ( auto &thread : threads )
+		thread.join();
+
+	for ( auto const& e : exceptions )
+		if ( e )
+			std::rethrow_exception(e);
+}
+
+} /* namespace auxillary */
+} /* namespace gslpp */
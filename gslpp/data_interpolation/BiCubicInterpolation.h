@@ -10,12 +10,15 @@
 
 #include <cstdlib>
 #include <vector>
-#include <set>
 #include <cstdlib>
 #include <algorithm>
 #include <cmath>
 #include <iterator>
 #include "gslpp/data_interpolation/BiCubicPolynomial.h"
+#include "gslpp/data_interpolation/src/KnotIndex.h"
+#include "gslpp/data_interpolation/CubeSpline.h"
+#include "gslpp/data_interpolation/MonotoneCubeHermiteSpline.h"
+#include "gslpp/data_interpolation/MultiSpline.h"
 
 namespace gslpp {
 namespace data_interpolation {
@@ -29,11 +32,20 @@ namespace data_interpolation {
  *
  * 	Internal data layout is with y low to high running faster and x low to high running slower.
  * 	 Thus, upon multiple evaluation, memory locality may benefit from evaluation in this respective order.
+ *
+ * 	The evaluation does not modify the object, such that it can be evaluated concurrently from many threads.
+ * 	Callers that evaluate at nearby points in sequence can keep a Cursor per thread and pass it to the evaluation.
  */
 template<typename T>
 class BiCubicInterpolation {
 public:
 
+	/**	The cell of the last evaluation along x and y, see KnotIndex.find_interval(T,KnotCursor&) */
+	struct Cursor {
+		KnotCursor x;
+		KnotCursor y;
+	};
+
 	/**
 	 * Empty constructor calls BiCubicInterpolation.clear()
 	 */
@@ -79,6 +91,27 @@ public:
 	 */
 	void evaluate_derivative(T x, T y,T &gradX, T &gradY) const;
 
+	/**
+	 * Evaluate the Interpolator at the Point \f$(x,y)\f$ searching the cell from the one of the cursor.
+	 *
+	 * @param x The x coordinate.
+	 * @param y The y coordinate.
+	 * @param dataInterpolation Interpolated data at the Point \f$(x,y)\f$.
+	 * @param cursor The cell of the last evaluation. On output the cell of \f$(x,y)\f$.
+	 */
+	void evaluate(T x, T y, T &dataInterpolation, Cursor & cursor) const;
+
+	/**
+	 * Evaluate the derivative of the Interpolator at the Point \f$(x,y)\f$ searching the cell from the one of the cursor.
+	 *
+	 * @param x The x coordinate.
+	 * @param y The y coordinate.
+	 * @param gradX Interpolated derivative w.r.t. x of the data at the Point \f$(x,y)\f$.
+	 * @param gradY Interpolated derivative w.r.t. y of the data at the Point \f$(x,y)\f$.
+	 * @param cursor The cell of the last evaluation. On output the cell of \f$(x,y)\f$.
+	 */
+	void evaluate_derivative(T x, T y,T &gradX, T &gradY, Cursor & cursor) const;
+
 	/**
 	 * Compute the BiCubic interpolator from input data.
 	 *
@@ -126,12 +159,27 @@ public:
 	 * Get the range of definition.
 	 */
 	void data_range(T &xMin, T &xMax, T &yMin, T &yMax) const;
-private:
 
-	//store last access to speed up the local multiple evaluation speed
-	mutable size_t _xLastAccess, _yLastAccess;
+	/**
+	 * @return The number of polynomials along x, i.e. the number of grid points in x minus one.
+	 */
+	size_t num_polynomials_x() const;
+
+	/**
+	 * @return The number of polynomials along y, i.e. the number of grid points in y minus one.
+	 */
+	size_t num_polynomials_y() const;
+
+	/**
+	 * Access the polynomial of a cell of the grid.
+	 *
+	 * @param ix The index of the cell along x. Must be < BiCubicInterpolation.num_polynomials_x().
+	 * @param iy The index of the cell along y. Must be < BiCubicInterpolation.num_polynomials_y().
+	 * @return The polynomial between the grid points ix, ix+1 in x and iy, iy+1 in y.
+	 */
+	BiCubicPolynomial<T> const& get_polynomial(size_t ix, size_t iy) const;
+private:
 
-	//
 	std::vector<BiCubicPolynomial<T> > _interpolatingPolynomials;
 	//
 	//number of polynomials in each direction
@@ -141,10 +189,10 @@ private:
 	T _minRangeX, _minRangeY, _maxRangeX, _maxRangeY;
 	//
 	//the grid point x coordinates
-	std::set<T> _gridValuesX;
+	KnotIndex<T> _gridValuesX;
 	//
 	//the grid point y coordinates
-	std::set<T> _gridValuesY;
+	KnotIndex<T> _gridValuesY;
 	//
 	//flag true if the object is ready for access
 	bool _isInit;
@@ -153,6 +201,9 @@ private:
 	//	call an error it is in the range of no one
 	size_t find_polynomial_in_range(T argument1, T argument2) const ;
 	//
+	//the same starting from the cell of the cursor
+	size_t find_polynomial_in_range(T argument1, T argument2, Cursor & cursor) const ;
+	//
 	//initialize of members to zero
 	void set_to_zero();
 
@@ -127,6 +127,16 @@ public:
 	 * Erase the content and set the object to the initial state.
 	 */
 	void clear();
+
+	/**
+	 * Get the coefficients of the polynomial in the power basis of the distances to the lower corner.
+	 *
+	 * The polynomial is \f$ p(x,y) = \sum_{i,j=0}^{3} a_{ij} \Delta_y^i \Delta_x^j \f$ with
+	 * \f$ \Delta_x = x - x_{min} \f$ and \f$ \Delta_y = y - y_{min} \f$.
+	 *
+	 * @param coefficients On output, the coefficients \f$ a_{ij} \f$ in the layout i*4+j.
+	 */
+	void power_basis_coefficients(T (&coefficients)[16]) const;
 private:
 
 	///The coefficients of the Polynomial {\sum}_{ij} a(i,j) x ^ i * y ^ j.
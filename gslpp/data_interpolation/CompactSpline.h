@@ -0,0 +1,138 @@
+/*
+ * CompactSpline.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_DATA_INTERPOLATION_COMPACTSPLINE_H_
+#define GSLPP_DATA_INTERPOLATION_COMPACTSPLINE_H_
+
+#include <vector>
+#include <cstddef>
+#include "gslpp/auxillary/AlignedAllocator.h"
+#include "gslpp/data_interpolation/src/BaseRealFunctionOnInterval.h"
+#include "gslpp/data_interpolation/src/KnotIndex.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+/**
+ * 	A compact copy of a cubic spline for fast evaluation.
+ *
+ * 	The knots are stored once and the segment i is the polynomial
+ * 	\f$ p_i(x) = c_{0,i} + c_{1,i} \Delta + c_{2,i} \Delta^2 + c_{3,i} \Delta^3 \f$ with \f$ \Delta = x - x_i \f$,
+ * 	where the coefficients of the four orders are kept in separate arrays aligned to cache lines.
+ * 	Evaluation is thus a search for the segment followed by a Horner chain of multiply-adds without a division.
+ * 	A segment takes 5 numbers of type T instead of a polynomial object and a knot.
+ * 	The object has no mutable state and can be evaluated concurrently.
+ *
+ *	The template parameter T is supposed to be float or double.
+ */
+template<typename T = double>
+class CompactSpline : public BaseRealFunctionOnInterval<T, CompactSpline<T> > {
+public:
+
+	/**	Empty constructor calls just CompactSpline.clear().
+	 */
+	CompactSpline();
+
+	/**	Constructor that calls CompactSpline.initialize().
+	 *
+	 * @param source The spline to copy.
+	 */
+	template<class spline>
+	explicit CompactSpline(spline const& source);
+
+	/**	Copy the knots and the power basis coefficients of a spline.
+	 *
+	 * @param source A spline such as CubeSpline or MonotoneCubeHermiteSpline that provides num_polynomials()
+	 * 				and get_polynomial(i) where the polynomial provides min_range(), max_range(),
+	 * 				interval_length() and power_basis_coefficients().
+	 */
+	template<class spline>
+	void initialize(spline const& source);
+
+	/**	Erase the content and set the object to the initial state.
+	 */
+	void clear();
+
+	/**	@return The number of segments, i.e. the number of knots minus one. */
+	size_t num_segments() const;
+
+	/** Evaluate the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param value The value of the spline at x.
+	 */
+	void evaluate(T x, T &value) const;
+
+	/** Evaluate the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param value The value of the spline at x.
+	 * @param derivative The value of the derivative w.r.t. x of the spline at x.
+	 */
+	void evaluate(T x, T &value, T &derivative) const;
+
+	/** Evaluate the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param value The value of the spline at x.
+	 * @param derivative The value of the derivative w.r.t. x of the spline at x.
+	 * @param second_derivative The value of the second derivative w.r.t. x of the spline at x.
+	 */
+	void evaluate(T x, T &value, T &derivative, T &second_derivative) const;
+
+	/** Evaluate the derivative of the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param derivative The value of the derivative w.r.t. x of the spline at x.
+	 */
+	void evaluate_derivative(T x, T &derivative) const;
+
+	/** Evaluate the second derivative of the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param second_derivative The value of the second derivative w.r.t. x of the spline at x.
+	 */
+	void evaluate_second_derivative(T x, T &second_derivative) const;
+
+	/** Evaluate the spline at n positions.
+	 *
+	 * @param xs Pointer to the n positions.
+	 * @param values Pointer to space for the n values of the spline at the positions.
+	 * @param n The number of positions.
+	 */
+	void evaluate(T const * xs, T * values, size_t n) const;
+
+	/**	The coefficients of a polynomial of a spline in the powers of the distance to its lower knot.
+	 *
+	 * @param p A polynomial that provides interval_length() and power_basis_coefficients().
+	 * @param coefficients The coefficients of the orders 0 to 3.
+	 */
+	template<class polynomial>
+	static void segment_coefficients(polynomial const& p, T (&coefficients)[4]);
+private:
+
+	typedef std::vector<T, gslpp::auxillary::AlignedAllocator<T> > AlignedArray;
+
+	KnotIndex<T> _knots;
+
+	//the coefficients of the orders 0 to 3 of all segments
+	AlignedArray _c0;
+
+	AlignedArray _c1;
+
+	AlignedArray _c2;
+
+	AlignedArray _c3;
+
+	size_t find_segment(T x) const;
+};
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
+
+#include "gslpp/data_interpolation/src/CompactSpline.hpp"
+#endif /* GSLPP_DATA_INTERPOLATION_COMPACTSPLINE_H_ */
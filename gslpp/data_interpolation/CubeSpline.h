@@ -9,13 +9,14 @@
 #define GSLPP_DATA_INTERPOLATION_CUBESPLINE_H_
 
 #include <vector>
+#include <deque>
 #include <set>
 #include <cstddef>
 #include <cmath>
 #include "gslpp/data_interpolation/src/BaseSpline.h"
 #include "gslpp/data_interpolation/src/BaseRealFunctionOnInterval.h"
+#include "gslpp/data_interpolation/MultiSpline.h"
 #include "gslpp/error_handling/Error.h"
-#include "gslpp/linear_algebra/LinearAlgebra.h"
 
 namespace gslpp {
 namespace data_interpolation {
@@ -24,6 +25,17 @@ namespace data_interpolation {
  * A cubic spline that interpolates data.
  *
  * 	The formula is according to Wikipedia [http://en.wikipedia.org/wiki/Spline_interpolation]
+ * 	The derivatives at the mesh points are the solution of a tridiagonal system, which is
+ * 	solved in O(N) time and memory.
+ *
+ * 	Points can be appended, removed from the front and changed after the initialization, e.g. for a sliding
+ * 	window over a time series. The influence of a change on the derivatives decays by at least a factor of 2,
+ * 	and by \f$ 2-\sqrt{3} \f$ on a uniform mesh, per mesh point. The system is therefore solved again only within
+ * 	a window of CubeSpline.get_update_window() points around the change, keeping the derivatives at the border
+ * 	of the window. The cost per modification is independent of the number of points, while the difference to
+ * 	a new initialization is of the order of the change times the decay factor to the power of the window size.
+ * 	A spline that is never modified only stores its polynomials. The mesh, the data and the derivatives that a
+ * 	modification needs are recovered from the polynomials on the first modification, which takes O(N) once.
  */
 template<typename T = double,
 		class Polynom = CubicPolynomial<T> >
@@ -55,15 +67,58 @@ public:
 	 * Removes the content of the object and sets it to its inital state.
 	 */
 	void clear();
+
+	/**
+	 * Append a point at the end of the mesh. The spline must have been initialized with at least 2 points.
+	 *
+	 * @param x The position, which must be larger than the last one.
+	 * @param y The data value at x.
+	 */
+	void append(T x, T y);
+
+	/**
+	 * Remove the first point of the mesh. There must be at least 3 points.
+	 */
+	void pop_front();
+
+	/**
+	 * Change the data value of a point of the mesh.
+	 *
+	 * @param i The index of the point.
+	 * @param y The new data value at the point.
+	 */
+	void update(size_t i, T y);
+
+	/**
+	 * Set the number of points to each side of a modification where the derivatives are computed again.
+	 *
+	 * @param numPoints The size of the window, at least 1. The default is 48.
+	 */
+	void set_update_window(size_t numPoints);
+
+	/**
+	 * @return The number of points to each side of a modification where the derivatives are computed again.
+	 */
+	size_t get_update_window() const;
 private:
 
-	size_t _splineMatrixDim;
-	std::vector<T> _splineMatrix;
-	std::vector<T> _splineVector;
+	//the mesh, the data and the derivatives for the modification after the initialization.
+	//	They are empty until the first modification.
+	std::deque<T> _mesh;
+
+	std::deque<T> _data;
+
+	std::deque<T> _derivatives;
+
+	size_t _updateWindow;
+
+	//set up the mesh, the data and the derivatives from the polynomials if this is the first modification
+	void make_modifiable();
 
-	void build_spline_matrix( std::vector<T> const& data, std::vector<T> const& mesh );
+	//solve again for the derivatives of the points first to last and set the polynomials in between
+	void solve_in_window(size_t first, size_t last);
 
-	void find_derivatives_and_build_polynominals( std::vector<T> const& data, std::vector<T> const& mesh);
+	void build_polynominals(size_t first, size_t last);
 };
 
 } /* namespace data_interpolation */
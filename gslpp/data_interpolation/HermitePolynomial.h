@@ -67,6 +67,16 @@ public:
 	 */
 	void evaluate_second_derivative(T x, T &value) const;
 
+	/**
+	 * @return The data value at range infinium.
+	 */
+	T value_at_range_min() const;
+
+	/**
+	 * @return The data value at range suppremum.
+	 */
+	T value_at_range_max() const;
+
 	/**
 	 * @return The derivative of the data at range infinium.
 	 */
@@ -76,6 +86,15 @@ public:
 	 * @return The derivative of the data at range suppremum.
 	 */
 	T derivative_at_range_max() const;
+
+	/**
+	 * Get the coefficients of the polynomial in the power basis of the normalized variable.
+	 *
+	 * The polynomial is \f$ p(x) = \sum_{k=0}^{3} c_k t^k \f$ with \f$ t = (x-x_1)/(x_2-x_1) \f$.
+	 *
+	 * @param coefficients On output, the coefficients \f$ c_0 \dots c_3 \f$.
+	 */
+	void power_basis_coefficients(T (&coefficients)[4]) const;
 private:
 
 	/** Store the coefficients of the Hermite basis
@@ -0,0 +1,129 @@
+/*
+ * MappedBiCubicInterpolation.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_DATA_INTERPOLATION_MAPPEDBICUBICINTERPOLATION_H_
+#define GSLPP_DATA_INTERPOLATION_MAPPEDBICUBICINTERPOLATION_H_
+
+#include <string>
+#include <cstddef>
+#include "gslpp/data_interpolation/src/KnotIndex.h"
+#include "gslpp/data_interpolation/TableFile.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+/**
+ * 	A read only bicubic interpolation that is evaluated directly from a mapped TableFile.
+ *
+ * 	The 16 coefficients of a cell are consecutive in the file, with y running faster than x
+ * 	as in BiCubicInterpolation. The object has no mutable state and can be evaluated concurrently.
+ *
+ *	The template parameter T is supposed to be float or double.
+ */
+template<typename T>
+class MappedBiCubicInterpolation {
+public:
+
+	/**
+	 * Empty constructor calls MappedBiCubicInterpolation.clear()
+	 */
+	MappedBiCubicInterpolation();
+
+	/**
+	 * Constructor that calls MappedBiCubicInterpolation.initialize()
+	 *
+	 * @param fileName The name of the table file.
+	 */
+	explicit MappedBiCubicInterpolation(std::string const& fileName);
+
+	/**
+	 * Map a table file that was written with TableFile.write() from a BiCubicInterpolation.
+	 *
+	 * @param fileName The name of the table file.
+	 */
+	void initialize(std::string const& fileName);
+
+	/**
+	 * 	Erase the content and set the object to the inital state.
+	 */
+	void clear();
+
+	/**
+	 * Evaluate the Interpolator at the Point \f$(x,y)\f$.
+	 *
+	 * Calls MappedBiCubicInterpolation.evaluate internally.
+	 */
+	T operator() (T x, T y) const;
+
+	/**
+	 * Evaluate the Interpolator at the Point \f$(x,y)\f$.
+	 *
+	 * @param x The x coordinate.
+	 * @param y The y coordinate.
+	 * @param dataInterpolation Interpolated data at the Point \f$(x,y)\f$.
+	 */
+	void evaluate(T x, T y, T &dataInterpolation) const;
+
+	/**
+	 * Evaluate the derivative of the Interpolator at the Point \f$(x,y)\f$.
+	 *
+	 * @param x The x coordinate.
+	 * @param y The y coordinate.
+	 * @param gradX Interpolated derivative w.r.t. x of the data at the Point \f$(x,y)\f$.
+	 * @param gradY Interpolated derivative w.r.t. y of the data at the Point \f$(x,y)\f$.
+	 */
+	void evaluate_derivative(T x, T y,T &gradX, T &gradY) const;
+
+	/**
+	 * @return the infinium of the range of definition in x
+	 */
+	T min_range_x() const;
+
+	/**
+	 * @return the infinium of the range of definition in y
+	 */
+	T min_range_y() const;
+
+	/**
+	 * @return the suppremum of the range of definition in x
+	 */
+	T max_range_x() const;
+
+	/**
+	 * @return the suppremum of the range of definition in y
+	 */
+	T max_range_y() const;
+
+	/**
+	 * Get the range of definition.
+	 */
+	void data_range(T &xMin, T &xMax, T &yMin, T &yMax) const;
+private:
+
+	TableFile<T> _file;
+
+	//views of the knots in the mapping
+	KnotIndex<T> _gridValuesX;
+
+	KnotIndex<T> _gridValuesY;
+
+	//the 16 coefficients of each cell in the mapping
+	T const * _coefficients;
+
+	size_t _numPolynomsY;
+
+	bool _isInit;
+
+	//the coefficients of the cell of (x,y) and the distances to its lower corner
+	T const * find_cell(T x, T y, T &deltaX, T &deltaY) const;
+};
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
+
+#include "gslpp/data_interpolation/src/MappedBiCubicInterpolation.hpp"
+#endif /* GSLPP_DATA_INTERPOLATION_MAPPEDBICUBICINTERPOLATION_H_ */
@@ -0,0 +1,118 @@
+/*
+ * MappedSpline.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_DATA_INTERPOLATION_MAPPEDSPLINE_H_
+#define GSLPP_DATA_INTERPOLATION_MAPPEDSPLINE_H_
+
+#include <string>
+#include <cstddef>
+#include "gslpp/data_interpolation/src/BaseRealFunctionOnInterval.h"
+#include "gslpp/data_interpolation/src/KnotIndex.h"
+#include "gslpp/data_interpolation/TableFile.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+/**
+ * 	A read only cubic spline that is evaluated directly from a mapped TableFile.
+ *
+ * 	The evaluation is the same as in CompactSpline, but the knots and coefficients are not copied:
+ * 	loading a table is independent of its size and the pages are read from the file on first access.
+ * 	The object has no mutable state and can be evaluated concurrently.
+ *
+ *	The template parameter T is supposed to be float or double.
+ */
+template<typename T = double>
+class MappedSpline : public BaseRealFunctionOnInterval<T, MappedSpline<T> > {
+public:
+
+	/**	Empty constructor calls just MappedSpline.clear().
+	 */
+	MappedSpline();
+
+	/**	Constructor that calls MappedSpline.initialize().
+	 *
+	 * @param fileName The name of the table file.
+	 */
+	explicit MappedSpline(std::string const& fileName);
+
+	/**	Map a table file that was written with TableFile.write() from a spline.
+	 *
+	 * @param fileName The name of the table file.
+	 */
+	void initialize(std::string const& fileName);
+
+	/**	Erase the content and set the object to the initial state.
+	 */
+	void clear();
+
+	/**	@return The number of segments, i.e. the number of knots minus one. */
+	size_t num_segments() const;
+
+	/** Evaluate the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param value The value of the spline at x.
+	 */
+	void evaluate(T x, T &value) const;
+
+	/** Evaluate the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param value The value of the spline at x.
+	 * @param derivative The value of the derivative w.r.t. x of the spline at x.
+	 */
+	void evaluate(T x, T &value, T &derivative) const;
+
+	/** Evaluate the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param value The value of the spline at x.
+	 * @param derivative The value of the derivative w.r.t. x of the spline at x.
+	 * @param second_derivative The value of the second derivative w.r.t. x of the spline at x.
+	 */
+	void evaluate(T x, T &value, T &derivative, T &second_derivative) const;
+
+	/** Evaluate the derivative of the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param derivative The value of the derivative w.r.t. x of the spline at x.
+	 */
+	void evaluate_derivative(T x, T &derivative) const;
+
+	/** Evaluate the second derivative of the spline at position x.
+	 *
+	 * @param x The position.
+	 * @param second_derivative The value of the second derivative w.r.t. x of the spline at x.
+	 */
+	void evaluate_second_derivative(T x, T &second_derivative) const;
+
+	/** Evaluate the spline at n positions.
+	 *
+	 * @param xs Pointer to the n positions.
+	 * @param values Pointer to space for the n values of the spline at the positions.
+	 * @param n The number of positions.
+	 */
+	void evaluate(T const * xs, T * values, size_t n) const;
+private:
+
+	TableFile<T> _file;
+
+	//a view of the knots in the mapping
+	KnotIndex<T> _knots;
+
+	//the 4 coefficients of each segment in the mapping
+	T const * _coefficients;
+
+	size_t find_segment(T x) const;
+};
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
+
+#include "gslpp/data_interpolation/src/MappedSpline.hpp"
+#endif /* GSLPP_DATA_INTERPOLATION_MAPPEDSPLINE_H_ */
@@ -10,6 +10,7 @@
 
 #include <set>
 #include <vector>
+#include <deque>
 #include "gslpp/data_interpolation/HermitePolynomial.h"
 #include "gslpp/data_interpolation/src/BaseSpline.h"
 
@@ -21,6 +22,19 @@ namespace data_interpolation {
  *
  *	The template parameter T is supposed to be float or double.
  *	For details on the algorithm see http://en.wikipedia.org/wiki/Monotone_cubic_interpolation
+ *
+ *	Points can be appended, removed from the front and changed after the initialization, e.g. for a sliding
+ *	window over a time series. The adjustment of the derivatives is repeated from the first affected point only
+ *	until it arrives at the state of the previous adjustment, which is typically after a few points.
+ *	The result is identical to a new initialization with the modified data.
+ *
+ *	The initialization splits the mesh into chunks that are processed by several threads. Each thread computes
+ *	the secants, the adjustment and the polynomials of its chunk in a single pass. Since the adjustment is
+ *	sequential, all chunks except the first start from a guess of the state that the previous chunk leaves.
+ *	The steps are then repeated from the true state until they arrive at the state from the guess, such that the
+ *	result does not depend on the number of threads. Only the polynomials are stored. The mesh, the data and the
+ *	state of the adjustment that a modification needs are set up from the polynomials on the first modification,
+ *	which takes O(N) once.
  */
 template<typename T = double, class Polynom = HermitePolynomial<T> >
 class MonotoneCubeHermiteSpline : public BaseSpline<MonotoneCubeHermiteSpline<T,Polynom>,T,Polynom> {
@@ -44,14 +58,146 @@ public:
 	 */
 	void initialize(std::vector<T> const& mesh,std::vector<T> const& data);
 
+	/**
+	 * Removes the content of the object and sets it to its inital state.
+	 */
+	void clear();
+
+	/**
+	 * Append a point at the end of the mesh. The spline must have been initialized with at least 2 points.
+	 *
+	 * @param x The position, which must be larger than the last one.
+	 * @param y The data value at x.
+	 */
+	void append(T x, T y);
+
+	/**
+	 * Remove the first point of the mesh. There must be at least 3 points.
+	 */
+	void pop_front();
+
+	/**
+	 * Change the data value of a point of the mesh.
+	 *
+	 * @param i The index of the point.
+	 * @param y The new data value at the point.
+	 */
+	void update(size_t i, T y);
+
+	/**
+	 * Find the position where the spline takes a value.
+	 *
+	 * See MonotoneCubeHermiteSpline.evaluate_inverse(T const *, T *, size_t) const.
+	 *
+	 * @param y The value.
+	 * @return The position x with spline(x) = y.
+	 */
+	T evaluate_inverse(T y) const;
+
+	/**
+	 * Find the positions where the spline takes the values of an array.
+	 *
+	 * The data must be monotone, either increasing or decreasing. For each value, the interval is found by a
+	 * binary search in the data at the mesh points. In the interval, the cubic polynomial is solved with Newton steps
+	 * that fall back to a bisection if they leave the bracket of the root. The values are processed in blocks, where
+	 * the steps for all values of a block are done together until all of them are converged.
+	 *
+	 * In a flat part of the spline, the first position with the value is found. Values before the first data value
+	 * in the direction of the data give the first mesh point and values behind the last data value the last one.
+	 *
+	 * @param ys Pointer to the n values.
+	 * @param xs Pointer to n elements that are set to the positions with spline(x) = y.
+	 * @param n The number of values.
+	 */
+	void evaluate_inverse(T const * ys, T * xs, size_t n) const;
+
+	/**
+	 * Set the number of threads for the initialization.
+	 *
+	 * Meshes with less than gslpp::auxillary::minItemsPerThread points per thread use less threads.
+	 *
+	 * @param numThreads The number of threads. With 0, the default, std::thread::hardware_concurrency() is used.
+	 */
+	void set_num_threads(size_t numThreads);
+
+	/**
+	 * @return The number of threads for the initialization.
+	 */
+	size_t get_num_threads() const;
+
 private:
 
-	//compute the derivative values
-	void compute_derivatives_no_adjusting(std::vector<T> const& mesh,std::vector<T> const& data,
-			std::vector<T> &derivatives, std::vector<T> &secants) const;
+	size_t _numThreads;
+
+	//the number of values that are inverted together
+	static constexpr size_t _inverseBlockSize = 64;
+
+	//the state of the adjustment at a point i: the adjusted derivative at i-1 and the derivative and beta
+	//	as they are left by step i-1
+	struct AdjustmentState {
+		T previousDerivative;
+		T enteringDerivative;
+		T enteringBeta;
+	};
+
+	//the mesh and the data. They and the following members are empty until the first modification.
+	std::deque<T> _mesh;
+
+	std::deque<T> _data;
+
+	//the derivatives after the adjustment for monotonicity
+	std::deque<T> _derivatives;
+
+	//the adjustment goes through the intervals in order. The step for interval i depends on the previous steps
+	//	only through the derivative at i and the value of beta as they are left by step i-1, which are stored here.
+	std::deque<T> _enteringDerivatives;
+
+	std::deque<T> _enteringBetas;
+
+	T secant(size_t i) const;
+
+	//the average of the two secants of the adjacent intervals, or the secant at the first and the last point
+	T derivative_no_adjusting(size_t i) const;
+
+	//the step of the adjustment for monotonicity for an interval with the given secant. On input, derivative and
+	//	nextDerivative are the entering derivative of the interval and the derivative without adjusting at its end.
+	//	On output, they are the adjusted derivative and the entering derivative at the end of the interval.
+	static void adjustment_step(T secant, T enteringBeta, T & derivative, T & nextDerivative, T & nextEnteringBeta);
+
+	//repeat the adjustment from interval firstStep. Points up to lastChanged have a changed derivative without
+	//	adjusting. Returns the end of the range of points with a possibly changed adjusted derivative.
+	size_t adjust_derivatives(size_t firstStep, size_t lastChanged);
+
+	//the same for interval i of a mesh and data, where derivative is the entering derivative on input
+	static void adjustment_step(std::vector<T> const& mesh, std::vector<T> const& data, size_t i,
+			T enteringBeta, T & derivative, T & nextDerivative, T & nextEnteringBeta);
+
+	//the guess of the entering state at i > 0 that does not depend on the steps before i-1
+	static void guess_entering_state(std::vector<T> const& mesh, std::vector<T> const& data, size_t i,
+			T & enteringDerivative, T & enteringBeta);
+
+	//set the polynomials in the range from the stored mesh, data and derivatives
+	void set_polynomials(size_t first, size_t last);
+
+	//do the adjustment steps and set the polynomials of the intervals [first,last) in one pass. For first > 0
+	//	the steps start from a guess of the entering state and the polynomial before the chunk is not set.
+	void initialize_range(std::vector<T> const& mesh, std::vector<T> const& data, size_t first, size_t last,
+			AdjustmentState & stateAtEnd);
+
+	//repeat the steps of the intervals [first,last) from the true state at first until they arrive at the state
+	//	from the guess, where guessedStateAtEnd is the state that initialize_range left at last. On output,
+	//	state is the true state at last.
+	void correct_range(std::vector<T> const& mesh, std::vector<T> const& data, size_t first, size_t last,
+			AdjustmentState const& guessedStateAtEnd, AdjustmentState & state);
+
+	//set up the mesh, the data and the state of the adjustment from the polynomials if this is the first modification
+	void make_modifiable();
+
+	//the data value at the mesh point i from the polynomials
+	T value_at_point(size_t i) const;
 
-	//manipulate derivatives to assure monotonicity
-	void ensure_monotonicity_in_derivatives(std::vector<T> &derivatives, std::vector<T> const &secants) const;
+	//invert at most _inverseBlockSize values
+	void evaluate_inverse_block(T const * ys, T * xs, size_t n) const;
 };
 
 }; /* namespace data_interpolation */
@@ -0,0 +1,124 @@
+/*
+ * MultiSpline.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_DATA_INTERPOLATION_MULTISPLINE_H_
+#define GSLPP_DATA_INTERPOLATION_MULTISPLINE_H_
+
+#include <vector>
+#include <cstddef>
+#include "gslpp/auxillary/AlignedAllocator.h"
+#include "gslpp/data_interpolation/src/KnotIndex.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+/**
+ * 	Cubic splines of several columns of data on the same mesh.
+ *
+ * 	The splines are the same as CubeSpline, with a vanishing second derivative at the borders.
+ * 	Since the tridiagonal system depends only on the mesh, it is eliminated once for all columns,
+ * 	where the inner loops run over the columns. An evaluation locates the interval once and evaluates
+ * 	all columns with a Horner scheme that runs over contiguous coefficients of the columns.
+ *
+ * 	The data is a matrix with the mesh points as rows and the columns running fast in memory:
+ * 		data[i*numColumns + j] is the value of column j at mesh point i.
+ *
+ *	The template parameter T is supposed to be float or double.
+ */
+template<typename T = double>
+class MultiSpline {
+public:
+
+	/**	Empty constructor calls just MultiSpline.clear().
+	 */
+	MultiSpline();
+
+	/**	Constructor that calls MultiSpline.initialize().
+	 */
+	MultiSpline(std::vector<T> const& mesh, std::vector<T> const& data, size_t numColumns);
+
+	/**
+	 * Initialize the splines.
+	 *
+	 * @param mesh The strictly increasing mesh with at least 2 points.
+	 * @param data The data with mesh.size() rows and numColumns columns, the columns running fast.
+	 * @param numColumns The number of columns.
+	 */
+	void initialize(std::vector<T> const& mesh, std::vector<T> const& data, size_t numColumns);
+
+	/**	Erase the content and set the object to the initial state.
+	 */
+	void clear();
+
+	/**	@return The number of columns. */
+	size_t num_columns() const;
+
+	/**	@return The first point of the mesh. */
+	T min_range() const;
+
+	/**	@return The last point of the mesh. */
+	T max_range() const;
+
+	/**
+	 * Evaluate the splines of all columns at position x.
+	 *
+	 * @param x The position in [MultiSpline.min_range(),MultiSpline.max_range()].
+	 * @param values Pointer to space for the num_columns() values of the splines at x.
+	 */
+	void evaluate(T x, T * values) const;
+
+	/**
+	 * Evaluate the splines of all columns and their derivatives at position x.
+	 *
+	 * @param x The position in [MultiSpline.min_range(),MultiSpline.max_range()].
+	 * @param values Pointer to space for the num_columns() values of the splines at x.
+	 * @param derivatives Pointer to space for the num_columns() derivatives w.r.t. x of the splines at x.
+	 */
+	void evaluate(T x, T * values, T * derivatives) const;
+
+	/**
+	 * Evaluate the derivatives of the splines of all columns at position x.
+	 *
+	 * @param x The position in [MultiSpline.min_range(),MultiSpline.max_range()].
+	 * @param derivatives Pointer to space for the num_columns() derivatives w.r.t. x of the splines at x.
+	 */
+	void evaluate_derivative(T x, T * derivatives) const;
+
+	/**
+	 * Solve for the derivatives of the splines at the mesh points without building the splines.
+	 *
+	 * The second derivative vanishes at a border unless the derivatives there are given.
+	 * This is the spline system of CubeSpline as well, which solves it for a single column.
+	 *
+	 * @param mesh The strictly increasing mesh with at least 2 points.
+	 * @param data The data with mesh.size() rows and numColumns columns, the columns running fast.
+	 * @param numColumns The number of columns.
+	 * @param derivatives On output, the derivatives in the same layout as the data.
+	 * @param firstDerivatives If not a nullptr, the numColumns derivatives fixed at the first mesh point.
+	 * @param lastDerivatives If not a nullptr, the numColumns derivatives fixed at the last mesh point.
+	 */
+	static void solve_for_derivatives(std::vector<T> const& mesh, std::vector<T> const& data,
+			size_t numColumns, std::vector<T> & derivatives,
+			T const * firstDerivatives = nullptr, T const * lastDerivatives = nullptr);
+private:
+
+	KnotIndex<T> _knots;
+
+	size_t _numColumns;
+
+	//the coefficients of the polynomial in x - x_i for interval i. The layout is
+	//	[i*4*_numColumns + order*_numColumns + column] such that the columns of an order are contiguous
+	std::vector<T, gslpp::auxillary::AlignedAllocator<T> > _coefficients;
+
+	size_t find_interval(T x) const;
+};
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
+
+#include "gslpp/data_interpolation/src/MultiSpline.hpp"
+#endif /* GSLPP_DATA_INTERPOLATION_MULTISPLINE_H_ */
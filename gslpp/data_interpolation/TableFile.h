@@ -0,0 +1,143 @@
+/*
+ * TableFile.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_DATA_INTERPOLATION_TABLEFILE_H_
+#define GSLPP_DATA_INTERPOLATION_TABLEFILE_H_
+
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include "gslpp/auxillary/MappedArray.h"
+#include "gslpp/data_interpolation/BiCubicInterpolation.h"
+#include "gslpp/data_interpolation/CompactSpline.h"
+#include "gslpp/data_interpolation/src/KnotIndex.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+/**
+ * 	A binary file with the knots and the power basis coefficients of an interpolation table,
+ * 	mapped into memory read only.
+ *
+ * 	The file starts with a header of 128 bytes: the 8 characters "GSLPPTAB", the version of the format,
+ * 	a byte order mark, the size of a number, the number of dimensions, the number of knots in each dimension
+ * 	and the spacing of the knots in each dimension as detected by KnotIndex. With the spacing in the header,
+ * 	the knots are not read when the file is mapped.
+ * 	The byte order mark is the 32 bit integer 0x01020304 in the byte order of the writer, such that a file
+ * 	from a machine with a different byte order is rejected instead of read as garbage.
+ *
+ * 	The knots of each dimension follow the header, then the coefficients of all segments. Each array starts at a
+ * 	multiple of 64 bytes. The coefficients of a segment are consecutive, such that an evaluation reads one
+ * 	or two cache lines of them. They are in the powers of the distance to the lower knot of the segment,
+ * 	see CompactSpline and BiCubicPolynomial.power_basis_coefficients().
+ *
+ * 	The file is mapped shared, such that all processes that map it use the same copy in the page cache.
+ * 	Copies of the object share the mapping.
+ *
+ *	The template parameter T is supposed to be float or double.
+ */
+template<typename T>
+class TableFile {
+public:
+
+	/**	The version of the format that is written and read. */
+	static constexpr uint32_t version = 2;
+
+	/**	Empty constructor of an object without a file.
+	 */
+	TableFile();
+
+	/**	Map a file and check its header.
+	 *
+	 * The file must be of the present version, in the byte order of this machine and with numbers of type T.
+	 *
+	 * @param fileName The name of the file.
+	 */
+	explicit TableFile(std::string const& fileName);
+
+	/**	Write the knots and the coefficients of a spline.
+	 *
+	 * @param fileName The name of the file, which is overwritten.
+	 * @param source A spline such as CubeSpline or MonotoneCubeHermiteSpline, see CompactSpline.initialize().
+	 */
+	template<class spline>
+	static void write(std::string const& fileName, spline const& source);
+
+	/**	Write the knots and the coefficients of a bicubic interpolation.
+	 *
+	 * @param fileName The name of the file, which is overwritten.
+	 * @param source The interpolation.
+	 */
+	static void write(std::string const& fileName, BiCubicInterpolation<T> const& source);
+
+	/**	@return The number of dimensions of the table, 1 for a spline and 2 for a bicubic interpolation. */
+	size_t dimensions() const;
+
+	/**	@return The number of knots in a dimension */
+	size_t num_knots(size_t dimension) const;
+
+	/**	@return The pointer to the knots of a dimension */
+	T const * knots(size_t dimension) const;
+
+	/**	@return The spacing of the knots of a dimension, see KnotIndex.mesh_type() */
+	typename KnotIndex<T>::MeshType mesh_type(size_t dimension) const;
+
+	/**	@return The origin of the knots of a dimension, see KnotIndex.origin() */
+	T origin(size_t dimension) const;
+
+	/**	@return The inverse spacing of the knots of a dimension, see KnotIndex.inverse_spacing() */
+	T inverse_spacing(size_t dimension) const;
+
+	/**	@return The pointer to the coefficients of all segments, 4 per segment for 1 dimension and 16 for 2 */
+	T const * coefficients() const;
+private:
+
+	struct Header {
+		char magic[8];
+		uint32_t version;
+		uint32_t byteOrderMark;
+		uint32_t valueSize;
+		uint32_t dimensions;
+		uint64_t numKnots[2];
+		uint32_t meshType[2];
+		double origin[2];
+		double inverseSpacing[2];
+		char reserved[48];
+	};
+	static_assert(sizeof(Header) == 128, "The header of a table file must have 128 bytes");
+
+	std::shared_ptr<gslpp::auxillary::MappedArray<T> > _mapping;
+
+	Header _header;
+
+	//the offsets of the arrays after the header in numbers of type T
+	size_t _knotsOffset[2];
+
+	size_t _coefficientsOffset;
+
+	//the number of values of type T in an array that is padded to a multiple of 64 bytes
+	static size_t padded_size(size_t numValues);
+
+	static void write_header(std::ofstream & file, std::string const& fileName,
+			KnotIndex<T> const * knots, size_t dimensions);
+
+	//write the knots of a dimension followed by the padding
+	static void write_knots(std::ofstream & file, KnotIndex<T> const& knots);
+
+	//write zeros behind an array of numValues up to the padded size
+	static void write_padding(std::ofstream & file, size_t numValues);
+
+	static void check_written(std::ofstream const& file, std::string const& fileName);
+};
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
+
+#include "gslpp/data_interpolation/src/TableFile.hpp"
+#endif /* GSLPP_DATA_INTERPOLATION_TABLEFILE_H_ */
@@ -9,16 +9,21 @@
 #define GSLPP_DATA_INTERPOLATION_BASESPLINE_H_
 
 #include <vector>
-#include <set>
 #include <cstddef>
+#include <string>
 #include "gslpp/error_handling/Error.h"
 #include "gslpp/data_interpolation/CubicPolynomial.h"
+#include "gslpp/data_interpolation/src/KnotIndex.h"
 
 namespace gslpp {
 namespace data_interpolation {
 
 /**
  * 	Base spline for shared code.
+ *
+ * 	The evaluation does not modify the object, such that a spline can be evaluated concurrently from many threads.
+ * 	Callers that evaluate at nearby positions in sequence, e.g. along a trajectory, can keep a Cursor per thread
+ * 	or trajectory and pass it to the evaluation. The polynomial is then searched starting from the last one.
  */
 template<class derived,
 		typename T = double,
@@ -26,6 +31,9 @@ template<class derived,
 class BaseSpline : public BaseRealFunctionOnInterval<T, BaseSpline<derived,T,polynom> > {
 public:
 
+	/**	The polynomial of the last evaluation, see KnotIndex.find_interval(T,KnotCursor&) */
+	typedef KnotCursor Cursor;
+
 	/**	Empty constructor calls just gslpp::data_interpolation::CubeSpline.clear().
 	 */
 	BaseSpline();
@@ -74,6 +82,97 @@ public:
 	 */
 	void evaluate_second_derivative(T x, T &second_derivative) const;
 
+	/** Evaluate the spine at position x searching the polynomial from the one of the cursor.
+	 *
+	 * @param x The position.
+	 * @param value The value of the polynomial at x.
+	 * @param cursor The polynomial of the last evaluation. On output the polynomial of x.
+	 */
+	void evaluate(T x, T &value, Cursor & cursor) const;
+
+	/** Evaluate the spine at position x searching the polynomial from the one of the cursor.
+	 *
+	 * @param x The position.
+	 * @param value The value of the polynomial at x.
+	 * @param derivative The value of the derivative w.r.t. x of the polynomial at x.
+	 * @param cursor The polynomial of the last evaluation. On output the polynomial of x.
+	 */
+	void evaluate(T x, T &value, T &derivative, Cursor & cursor) const;
+
+	/** Evaluate the spine at position x searching the polynomial from the one of the cursor.
+	 *
+	 * @param x The position.
+	 * @param value The value of the polynomial at x.
+	 * @param derivative The value of the derivative w.r.t. x of the polynomial at x.
+	 * @param second_derivative The value of the second derivative w.r.t. x of the polynomial at x.
+	 * @param cursor The polynomial of the last evaluation. On output the polynomial of x.
+	 */
+	void evaluate(T x, T &value, T &derivative, T &second_derivative, Cursor & cursor) const;
+
+	/** Evaluate the derivative of the spine at position x searching the polynomial from the one of the cursor.
+	 *
+	 * @param x The position.
+	 * @param derivative The value of the derivative w.r.t. x of the polynomial at x.
+	 * @param cursor The polynomial of the last evaluation. On output the polynomial of x.
+	 */
+	void evaluate_derivative(T x, T &derivative, Cursor & cursor) const;
+
+	/** Evaluate the second derivative of the spine at position x searching the polynomial from the one of the cursor.
+	 *
+	 * @param x The position.
+	 * @param second_derivative The value of the second derivative w.r.t. x of the polynomial at x.
+	 * @param cursor The polynomial of the last evaluation. On output the polynomial of x.
+	 */
+	void evaluate_second_derivative(T x, T &second_derivative, Cursor & cursor) const;
+
+	/** Evaluate the spline at n positions.
+	 *
+	 * Sorted positions are evaluated walking through the polynomials along with the positions, otherwise
+	 * the polynomials are located block wise and prefetched before the evaluation.
+	 * The polynomials are evaluated in the power basis with the Horner scheme. The result can thus differ
+	 * in the last digits from the evaluation at a single position.
+	 *
+	 * @param xs Pointer to the n positions.
+	 * @param values Pointer to space for the n values of the spline at the positions.
+	 * @param n The number of positions.
+	 */
+	void evaluate(T const * xs, T * values, size_t n) const;
+
+	/** Evaluate the spline and its derivative at n positions, see BaseSpline.evaluate(T const*,T*,size_t).
+	 *
+	 * @param xs Pointer to the n positions.
+	 * @param values Pointer to space for the n values of the spline at the positions.
+	 * @param derivatives Pointer to space for the n derivatives w.r.t. x at the positions.
+	 * @param n The number of positions.
+	 */
+	void evaluate(T const * xs, T * values, T * derivatives, size_t n) const;
+
+	/** Evaluate the spline and its first and second derivative at n positions, see BaseSpline.evaluate(T const*,T*,size_t).
+	 *
+	 * @param xs Pointer to the n positions.
+	 * @param values Pointer to space for the n values of the spline at the positions.
+	 * @param derivatives Pointer to space for the n derivatives w.r.t. x at the positions.
+	 * @param second_derivatives Pointer to space for the n second derivatives w.r.t. x at the positions.
+	 * @param n The number of positions.
+	 */
+	void evaluate(T const * xs, T * values, T * derivatives, T * second_derivatives, size_t n) const;
+
+	/** Evaluate the derivative of the spline at n positions, see BaseSpline.evaluate(T const*,T*,size_t).
+	 *
+	 * @param xs Pointer to the n positions.
+	 * @param derivatives Pointer to space for the n derivatives w.r.t. x at the positions.
+	 * @param n The number of positions.
+	 */
+	void evaluate_derivative(T const * xs, T * derivatives, size_t n) const;
+
+	/** Evaluate the second derivative of the spline at n positions, see BaseSpline.evaluate(T const*,T*,size_t).
+	 *
+	 * @param xs Pointer to the n positions.
+	 * @param second_derivatives Pointer to space for the n second derivatives w.r.t. x at the positions.
+	 * @param n The number of positions.
+	 */
+	void evaluate_second_derivative(T const * xs, T * second_derivatives, size_t n) const;
+
 	/**	Erase the content of the spline and set it to the initial state.
 	 */
 	void clear();
@@ -90,6 +189,19 @@ public:
 	 * @return Vector with the derivatives at the borders of the polynomials.
 	 */
 	std::vector<T> deriviatives_at_underlying_grid_points() const;
+
+	/**
+	 * @return The number of polynomials, i.e. the number of grid points minus one.
+	 */
+	size_t num_polynomials() const;
+
+	/**
+	 * Access the polynomial between grid point i and i+1.
+	 *
+	 * @param i The index of the polynomial. Must be < BaseSpline.num_polynomials().
+	 * @return The polynomial i.
+	 */
+	polynom const& get_polynomial(size_t i) const;
 protected:
 
 	/**	Set the internal mesh of x values. Also sets BaseRealFunctionOnInterval.set_range_of_definition .
@@ -106,18 +218,69 @@ protected:
 	 * @param p The polynom used for interpolation in this range.
 	 */
 	void insert_polynom(polynom const& p);
+
+	/**	Make room for the polynomials of all intervals of the grid, which are set with BaseSpline.replace_polynom.
+	 *
+	 *	Call after setting the grid. Different polynomials can be replaced concurrently.
+	 *
+	 * @param placeholder The polynom that is copied to all intervals until it is replaced.
+	 */
+	void resize_polynomials(polynom const& placeholder);
+
+	/**	Append a point to the internal mesh of x values and extend the range of definition.
+	 *
+	 *	Insert the polynomial of the new last interval with BaseSpline.insert_polynom afterwards.
+	 *
+	 * @param x The new point, which must be larger than the last one.
+	 */
+	void append_grid_point(T x);
+
+	/**	Remove the first point of the internal mesh of x values together with the first polynomial.
+	 *
+	 *	Amortized O(1), see KnotIndex.pop_front().
+	 */
+	void remove_first_grid_point();
+
+	/**	Replace the polynomial i.
+	 *
+	 *	On DEBUG_BUILD the method checks if the polynom matches the x mesh and fails if not.
+	 *
+	 * @param i The index of the polynomial.
+	 * @param p The polynom used for interpolation between grid point i and i+1.
+	 */
+	void replace_polynom(size_t i, polynom const& p);
 private:
 
 	//store the grid values upon initialization
-	std::set<T> _gridValuesX;
+	KnotIndex<T> _gridValuesX;
 
 	//store the polynomials
 	std::vector<polynom> _polynomials;
 
-	//store interval that was last accessed for increased local evaluation performance
-	mutable size_t _lastAccessedPolynomIndex;
+	//the polynomials before this index were removed with remove_first_grid_point
+	size_t _firstPolynomial;
 
 	size_t find_polynomial_in_range(T x) const;
+
+	size_t find_polynomial_in_range(T x, Cursor & cursor) const;
+
+	//the number of positions that are located and prefetched at once in the batched evaluation of unsorted positions
+	static constexpr size_t _batchBlockSize = 64;
+
+	//a polynomial in the power basis of t = (x-x1)*inverseLength
+	struct PowerBasisSegment {
+		T x1;
+		T inverseLength;
+		T c[4];
+	};
+
+	void load_segment(size_t i, PowerBasisSegment & segment) const;
+
+	//any of values, derivatives and second_derivatives may be nullptr in which case it is not computed
+	void evaluate_batch(T const * xs, T * values, T * derivatives, T * second_derivatives, size_t n) const;
+
+	static void evaluate_segment(PowerBasisSegment const& segment, T x, size_t k,
+			T * values, T * derivatives, T * second_derivatives);
 };
 
 } /* namespace data_interpolation */
@@ -6,6 +6,7 @@
  */
 
 #include "gslpp/data_interpolation/src/BaseSpline.h"
+#include <algorithm>
 
 namespace gslpp {
 namespace data_interpolation {
@@ -18,8 +19,8 @@ BaseSpline<derived,T,polynom>::BaseSpline() {
 template<class derived, typename T,class polynom>
 void BaseSpline<derived,T,polynom>::clear() {
 	_polynomials.clear();
+	_firstPolynomial = 0;
 	_gridValuesX.clear();
-	_lastAccessedPolynomIndex = 0;
 	this->set_init_state(false);
 }
 
@@ -37,54 +38,182 @@ size_t BaseSpline<derived,T,polynom>::find_polynomial_in_range(T x) const {
 				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
 	}
 #endif
-	if ( _polynomials[_lastAccessedPolynomIndex].x_is_in_range(x) )
-		return _lastAccessedPolynomIndex;
-	//
-	//the polynomial index is the index of the point that is not smaller than x
-	//	we use <algorithm> lower_bound which gives the iterator to the first element that does not compare less.
-	//	The result is thus equivalent to the index of the upper point of the polynomial, except equality which is
-	//		used in a different convention and we have to account for this
-	typename std::set<T>::const_iterator ptrToLBoundX;
-	ptrToLBoundX = _gridValuesX.lower_bound(x);
-	int indexX = std::distance(_gridValuesX.begin(),ptrToLBoundX)-1;
-	if ( *ptrToLBoundX == x)
-		indexX += 1;
-	//
-	_lastAccessedPolynomIndex = static_cast<size_t>( indexX );
-	return _lastAccessedPolynomIndex;
+	//the polynomial index is the index of the last grid point that is not larger than x
+	return _gridValuesX.find_interval(x);
+}
+
+template<class derived, typename T,class polynom>
+size_t BaseSpline<derived,T,polynom>::find_polynomial_in_range(T x, Cursor & cursor) const {
+#ifdef DEBUG_BUILD
+	if ( not this->x_is_in_range(x) ) {
+		gslpp::error_handling::Error( "Cannot find a polynomial in range for x that is out of range!" ,
+				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+	}
+#endif
+	return _gridValuesX.find_interval(x,cursor);
 }
 
 template<class derived, typename T,class polynom>
 void BaseSpline<derived,T,polynom>::evaluate(T x, T &value) const {
-	_lastAccessedPolynomIndex =  this->find_polynomial_in_range(x);
-	 _polynomials[_lastAccessedPolynomIndex].evaluate(x,value);
+	_polynomials[_firstPolynomial+this->find_polynomial_in_range(x)].evaluate(x,value);
 }
 
 template<class derived, typename T,class polynom>
 void BaseSpline<derived,T,polynom>::evaluate(T x, T &value, T &derivative) const {
-	this->evaluate(x,value);
-
-	//_lastAccessedPolynomIndex is now set to this->find_polynomial_in_range(x)
-	//	no need to call it again
-	 _polynomials[_lastAccessedPolynomIndex].evaluate_derivative(x,derivative);
+	polynom const& p = _polynomials[_firstPolynomial+this->find_polynomial_in_range(x)];
+	p.evaluate(x,value);
+	p.evaluate_derivative(x,derivative);
 }
 
 template<class derived, typename T,class polynom>
 void BaseSpline<derived,T,polynom>::evaluate(T x, T &value, T &derivative,T &second_derivative) const {
-	this->evaluate(x,value,derivative);
-	 _polynomials[_lastAccessedPolynomIndex].evaluate_second_derivative(x,second_derivative);
+	polynom const& p = _polynomials[_firstPolynomial+this->find_polynomial_in_range(x)];
+	p.evaluate(x,value);
+	p.evaluate_derivative(x,derivative);
+	p.evaluate_second_derivative(x,second_derivative);
 }
 
 template<class derived, typename T,class polynom>
 void BaseSpline<derived,T,polynom>::evaluate_derivative(T x, T &derivative) const {
-	_lastAccessedPolynomIndex =  this->find_polynomial_in_range(x);
-	 _polynomials[_lastAccessedPolynomIndex].evaluate_derivative(x,derivative);
+	_polynomials[_firstPolynomial+this->find_polynomial_in_range(x)].evaluate_derivative(x,derivative);
 }
 
 template<class derived, typename T,class polynom>
 void BaseSpline<derived,T,polynom>::evaluate_second_derivative(T x, T &second_derivative) const {
-	_lastAccessedPolynomIndex =  this->find_polynomial_in_range(x);
-	 _polynomials[_lastAccessedPolynomIndex].evaluate_second_derivative(x,second_derivative);
+	_polynomials[_firstPolynomial+this->find_polynomial_in_range(x)].evaluate_second_derivative(x,second_derivative);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate(T x, T &value, Cursor & cursor) const {
+	_polynomials[_firstPolynomial+this->find_polynomial_in_range(x,cursor)].evaluate(x,value);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate(T x, T &value, T &derivative, Cursor & cursor) const {
+	polynom const& p = _polynomials[_firstPolynomial+this->find_polynomial_in_range(x,cursor)];
+	p.evaluate(x,value);
+	p.evaluate_derivative(x,derivative);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate(T x, T &value, T &derivative,T &second_derivative,
+		Cursor & cursor) const {
+	polynom const& p = _polynomials[_firstPolynomial+this->find_polynomial_in_range(x,cursor)];
+	p.evaluate(x,value);
+	p.evaluate_derivative(x,derivative);
+	p.evaluate_second_derivative(x,second_derivative);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate_derivative(T x, T &derivative, Cursor & cursor) const {
+	_polynomials[_firstPolynomial+this->find_polynomial_in_range(x,cursor)].evaluate_derivative(x,derivative);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate_second_derivative(T x, T &second_derivative, Cursor & cursor) const {
+	_polynomials[_firstPolynomial+this->find_polynomial_in_range(x,cursor)].evaluate_second_derivative(x,second_derivative);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate(T const * xs, T * values, size_t n) const {
+	this->evaluate_batch(xs,values,nullptr,nullptr,n);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate(T const * xs, T * values, T * derivatives, size_t n) const {
+	this->evaluate_batch(xs,values,derivatives,nullptr,n);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate(T const * xs, T * values, T * derivatives,
+		T * second_derivatives, size_t n) const {
+	this->evaluate_batch(xs,values,derivatives,second_derivatives,n);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate_derivative(T const * xs, T * derivatives, size_t n) const {
+	this->evaluate_batch(xs,nullptr,derivatives,nullptr,n);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate_second_derivative(T const * xs, T * second_derivatives, size_t n) const {
+	this->evaluate_batch(xs,nullptr,nullptr,second_derivatives,n);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::load_segment(size_t i, PowerBasisSegment & segment) const {
+	polynom const& p = _polynomials[_firstPolynomial+i];
+	segment.x1 = p.min_range();
+	segment.inverseLength = T(1)/p.interval_length();
+	p.power_basis_coefficients(segment.c);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate_segment(PowerBasisSegment const& segment, T x, size_t k,
+		T * values, T * derivatives, T * second_derivatives) {
+	const T t = (x - segment.x1)*segment.inverseLength;
+	if ( values != nullptr )
+		values[k] = segment.c[0] + t*(segment.c[1] + t*(segment.c[2] + t*segment.c[3]));
+	if ( derivatives != nullptr )
+		derivatives[k] = (segment.c[1] + t*(2*segment.c[2] + t*3*segment.c[3]))*segment.inverseLength;
+	if ( second_derivatives != nullptr )
+		second_derivatives[k] = (2*segment.c[2] + t*6*segment.c[3])*segment.inverseLength*segment.inverseLength;
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::evaluate_batch(T const * xs, T * values, T * derivatives,
+		T * second_derivatives, size_t n) const {
+	if ( n == 0 )
+		return;
+#ifdef DEBUG_BUILD
+	if ( not this->is_init() ){
+		gslpp::error_handling::Error("Spline is not init while trying to evaluate",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+	}
+	for ( size_t k = 0 ; k < n ; ++k ) {
+		if ( not this->x_is_in_range(xs[k]) ) {
+			gslpp::error_handling::Error( "Cannot find a polynomial in range for x that is out of range!" ,
+					gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+		}
+	}
+#endif
+	bool isSorted = true;
+	for ( size_t k = 1 ; k < n ; ++k )
+		isSorted = isSorted and ( xs[k-1] <= xs[k] );
+
+	PowerBasisSegment segment;
+	if ( isSorted ) {
+		//walk through the knots along with the positions and load a polynomial only once
+		T const * knots = _gridValuesX.data();
+		const size_t lastPolynomial = this->num_polynomials() - 1;
+		size_t i = _gridValuesX.find_interval(xs[0]);
+		this->load_segment(i,segment);
+		for ( size_t k = 0 ; k < n ; ++k ) {
+			if ( (i < lastPolynomial) and (knots[i+1] <= xs[k]) ) {
+				while ( (i < lastPolynomial) and (knots[i+1] <= xs[k]) )
+					++i;
+				this->load_segment(i,segment);
+			}
+			evaluate_segment(segment,xs[k],k,values,derivatives,second_derivatives);
+		}
+		return;
+	}
+
+	//locate a block of positions first, such that the polynomials can be fetched while the others are searched
+	size_t indices[_batchBlockSize];
+	for ( size_t blockStart = 0 ; blockStart < n ; blockStart += _batchBlockSize ) {
+		const size_t blockEnd = std::min(n,blockStart + _batchBlockSize);
+		for ( size_t k = blockStart ; k < blockEnd ; ++k ) {
+			indices[k-blockStart] = _gridValuesX.find_interval(xs[k]);
+#ifdef __GNUC__
+			__builtin_prefetch(&_polynomials[_firstPolynomial+indices[k-blockStart]]);
+#endif
+		}
+		for ( size_t k = blockStart ; k < blockEnd ; ++k ) {
+			this->load_segment(indices[k-blockStart],segment);
+			evaluate_segment(segment,xs[k],k,values,derivatives,second_derivatives);
+		}
+	}
 }
 
 template<class derived, typename T,class polynom>
@@ -96,40 +225,29 @@ void BaseSpline<derived,T,polynom>::insert_grid(std::vector<T> const& strictlyIn
 				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
 	}
 #endif
-	_gridValuesX.insert( strictlyIncreasingGridX.begin() , strictlyIncreasingGridX.end() );
-#ifdef DEBUG_BUILD
-	//check if strictlyIncreasingGridX is sorted
-	typename std::set<T>::const_iterator it = _gridValuesX.begin();
-	for ( size_t i = 0 ; i < strictlyIncreasingGridX.size() ; ++i){
-		if ( *it != strictlyIncreasingGridX[i] ){
-			gslpp::error_handling::Error("Input grid not sorted",
-					gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
-		}
-		++it;
+	//on DEBUG_BUILD this checks if strictlyIncreasingGridX is sorted
+	_gridValuesX.assign( strictlyIncreasingGridX );
+	//an empty grid would underflow the size and has no range
+	if ( strictlyIncreasingGridX.size() > 0 ) {
+		_polynomials.reserve( strictlyIncreasingGridX.size() - 1 );
+		this->set_range_of_definition(strictlyIncreasingGridX.front(),strictlyIncreasingGridX.back());
 	}
-#endif
-	this->set_range_of_definition(*_gridValuesX.begin(),*_gridValuesX.rbegin());
 }
 
 template<class derived, typename T,class polynom>
 void BaseSpline<derived,T,polynom>::insert_polynom(polynom const& p) {
 #ifdef DEBUG_BUILD
-	size_t polynomToBeInserted = _polynomials.size();
+	size_t polynomToBeInserted = this->num_polynomials();
 	//check if _gridValuesX is set
 	if ( _gridValuesX.empty() ){
 		gslpp::error_handling::Error("Input grid not set. Set before inserting polynomials",
 				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
 	}
 
-	//check if the polynomial firts into the present slot
-	//	find the index of the grid value that corresponds to the present polynomial p.
-	typename std::set<T>::iterator ptrToLBoundX;
-	ptrToLBoundX = _gridValuesX.lower_bound( p.min_range() );
-	int indexX = std::distance(_gridValuesX.begin(),ptrToLBoundX)-1;
-	if ( *ptrToLBoundX == p.min_range() )
-		indexX += 1;
-	//	This must be polynomToBeInserted
-	if ( static_cast<size_t>(indexX) != polynomToBeInserted ) {
+	//check if the polynomial fits into the present slot
+	//	the grid value that corresponds to the present polynomial p must be at polynomToBeInserted.
+	if ( ( polynomToBeInserted+1 >= _gridValuesX.size() ) or
+			( _gridValuesX[polynomToBeInserted] != p.min_range() ) ) {
 		gslpp::error_handling::Error("Input polynom not in the right order or does not match the grid.",
 				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
 	}
@@ -137,10 +255,57 @@ void BaseSpline<derived,T,polynom>::insert_polynom(polynom const& p) {
 	_polynomials.push_back(p);
 }
 
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::resize_polynomials(polynom const& placeholder) {
+#ifdef DEBUG_BUILD
+	if ( _gridValuesX.empty() ){
+		gslpp::error_handling::Error("Input grid not set. Set before inserting polynomials",
+				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+	}
+#endif
+	_polynomials.resize(_firstPolynomial + _gridValuesX.size() - 1,placeholder);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::append_grid_point(T x) {
+	_gridValuesX.push_back(x);
+	this->set_range_of_definition(_gridValuesX[0],x);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::remove_first_grid_point() {
+#ifdef DEBUG_BUILD
+	if ( this->num_polynomials() <= 1 ){
+		gslpp::error_handling::Error("Removing the first grid point leaves no polynomial",
+				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+	}
+#endif
+	_gridValuesX.pop_front();
+	++_firstPolynomial;
+	//as for the knots, the removed polynomials are erased once they are the larger part of the storage
+	if ( 2*_firstPolynomial > _polynomials.size() ) {
+		_polynomials.erase(_polynomials.begin(),_polynomials.begin()+_firstPolynomial);
+		_firstPolynomial = 0;
+	}
+	this->set_range_of_definition(_gridValuesX[0],_gridValuesX[_gridValuesX.size()-1]);
+}
+
+template<class derived, typename T,class polynom>
+void BaseSpline<derived,T,polynom>::replace_polynom(size_t i, polynom const& p) {
+#ifdef DEBUG_BUILD
+	if ( ( i >= this->num_polynomials() ) or ( _gridValuesX[i] != p.min_range() )
+			or ( _gridValuesX[i+1] != p.max_range() ) ) {
+		gslpp::error_handling::Error("Replacing polynom does not match the grid.",
+				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+	}
+#endif
+	_polynomials[_firstPolynomial+i] = p;
+}
+
 template<class derived, typename T,class polynom>
 bool BaseSpline<derived,T,polynom>::is_init() const {
 	return ((not _gridValuesX.empty())
-			and  ( _gridValuesX.size() == (_polynomials.size()+1) )
+			and  ( _gridValuesX.size() == (this->num_polynomials()+1) )
 			and BaseRealFunctionOnInterval<T, BaseSpline<derived,T,polynom> >::is_init());
 }
 
@@ -153,13 +318,29 @@ std::vector<T> BaseSpline<derived,T,polynom>::deriviatives_at_underlying_grid_po
 	}
 #endif
 	std::vector<T> result;
-	result.reserve(_polynomials.size() + 1);
-	for (size_t i = 0; i < _polynomials.size(); i++){
-		result.push_back(_polynomials[i].derivative_at_range_min());
+	result.reserve(this->num_polynomials() + 1);
+	for (size_t i = 0; i < this->num_polynomials(); i++){
+		result.push_back(_polynomials[_firstPolynomial+i].derivative_at_range_min());
 	}
 	result.push_back(_polynomials.back().derivative_at_range_max());
 	return result;
 }
 
+template<class derived, typename T,class polynom>
+size_t BaseSpline<derived,T,polynom>::num_polynomials() const {
+	return _polynomials.size() - _firstPolynomial;
+}
+
+template<class derived, typename T,class polynom>
+polynom const& BaseSpline<derived,T,polynom>::get_polynomial(size_t i) const {
+#ifdef DEBUG_BUILD
+	if ( i >= this->num_polynomials() ){
+		gslpp::error_handling::Error("Access to polynomial "+std::to_string(i)+" out of range",
+				gslpp::error_handling::Error::OUT_OF_BOUNDS);
+	}
+#endif
+	return _polynomials[_firstPolynomial+i];
+}
+
 } /* namespace data_interpolation */
 } /* namespace gslpp */
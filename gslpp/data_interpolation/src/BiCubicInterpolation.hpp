@@ -6,10 +6,44 @@
  */
 
 #include "gslpp/data_interpolation/BiCubicInterpolation.h"
+#include "gslpp/error_handling/Error.h"
+#include <string>
 
 namespace gslpp {
 namespace data_interpolation {
 
+namespace delegate{
+//the derivatives at the mesh points of splines of type PolynomialT through each column of the data,
+//	where data[i*numColumns + j] is the value of column j at mesh point i.
+template<class PolynomialT, typename T>
+struct derivatives_of_columns {
+	static void call(std::vector<T> const& mesh, std::vector<T> const& data,
+			size_t numColumns, std::vector<T> & derivatives) {
+		const size_t numPoints = mesh.size();
+		derivatives.assign(numPoints*numColumns,T(0));
+		std::vector<T> sliceOfData(numPoints);
+		for ( size_t j = 0 ; j < numColumns ; ++j ) {
+			for ( size_t i = 0 ; i < numPoints ; ++i )
+				sliceOfData[i] = data[i*numColumns+j];
+			PolynomialT spline;
+			spline.initialize(mesh,sliceOfData);
+			std::vector<T> tmp = spline.deriviatives_at_underlying_grid_points();
+			for ( size_t i = 0 ; i < numPoints ; ++i )
+				derivatives[i*numColumns+j] = tmp[i];
+		}
+	};
+};
+
+//the cubic splines of all columns share the tridiagonal system, which is eliminated only once
+template<typename T>
+struct derivatives_of_columns< CubeSpline<T>, T > {
+	static void call(std::vector<T> const& mesh, std::vector<T> const& data,
+			size_t numColumns, std::vector<T> & derivatives) {
+		MultiSpline<T>::solve_for_derivatives(mesh,data,numColumns,derivatives);
+	};
+};
+}; /* namespace delegate */
+
 template<typename T>
 BiCubicInterpolation<T>::BiCubicInterpolation() {
 	this->clear();
@@ -30,8 +64,6 @@ void BiCubicInterpolation<T>::clear() {
 	_gridValuesX.clear();
 	_gridValuesY.clear();
 	_isInit = false;
-	_xLastAccess = 0;
-	_yLastAccess = 0;
 	_numPolynomsX = 0;
 	_numPolynomsY = 0;
 }
@@ -69,90 +101,35 @@ void BiCubicInterpolation<T>::initialize_t(std::vector<T> const& xGridPointValue
 				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
 
 	//insert the grids and in case of a debug build check if they were sorted.
-	_gridValuesX.insert(xGridPointValues.begin(),xGridPointValues.end());
-	_gridValuesY.insert(yGridPointValues.begin(),yGridPointValues.end());
-#ifdef DEBUG_BUILD
-	typename std::set<T>::const_iterator it = _gridValuesX.begin();
-	for ( size_t i = 0 ; i <numPtsX ; ++i){
-		if ( *it != xGridPointValues[i] )
-			gslpp::error_handling::Error("Input grid in x not sorted",
-					gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
-		++it;
-	}
-	it = _gridValuesY.begin();
-	for ( size_t i = 0 ; i < numPtsY ; ++i){
-		if ( *it != yGridPointValues[i] )
-			gslpp::error_handling::Error("Input grid in y not sorted",
-					gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
-		++it;
-	}
-#endif
-
-	//temporary array with the x derivatives at the grid values. Has the same ordering as the data.
-	std::vector<T> xDerivatives(xGridPointValues.size()*numPtsY,0.0);
-
-	//generate splines along the x direction
-	std::vector<T> sliceOfData(xGridPointValues.size(),0.0);
-
-	//for each y generate an interpolation along x and save the derivatives at the grid points.
-	for (size_t iy=0 ; iy < numPtsY ; iy++ ){
-
-		for ( size_t ix = 0 ; ix <numPtsX ; ix++)
-			sliceOfData[ix] = data[ix*numPtsY+iy];
-
-		PolynomialT xPolynomAtIY;
-		xPolynomAtIY.initialize(xGridPointValues,sliceOfData);
-
-		std::vector<T> tmp = xPolynomAtIY.deriviatives_at_underlying_grid_points();
-
-		//save the derivative values
-		for ( size_t ix = 0 ; ix <numPtsX ; ix++){
-			xDerivatives[ix*numPtsY+iy] = tmp[ix];
-		}
-	}
-	sliceOfData.clear();
-
-	//temporary array with the y derivatives at the grid values. Has the same ordering as the data.
-	std::vector<T> yDerivatives(xGridPointValues.size()*numPtsY,0.0);
-
-	sliceOfData.assign(numPtsY,0.0);
-
-	//for each x generate an interpolation along y and save the derivatives at the grid points.
-	for (size_t ix=0 ; ix <numPtsX ; ix++ ){
-
+	_gridValuesX.assign(xGridPointValues);
+	_gridValuesY.assign(yGridPointValues);
+
+	//the x derivatives at the grid values are those of the splines along x, one for each y.
+	//	Since the data is ordered with y running fast, it is a matrix with the y values as columns.
+	std::vector<T> xDerivatives;
+	delegate::derivatives_of_columns<PolynomialT,T>::call(xGridPointValues,data,numPtsY,xDerivatives);
+
+	//the y derivatives at the grid values from the transposed data
+	std::vector<T> transposed(numPtsX*numPtsY);
+	std::vector<T> transposedDerivatives;
+	for (size_t ix=0 ; ix <numPtsX ; ix++ )
 		for ( size_t iy = 0 ; iy <numPtsY ; iy++)
-			sliceOfData[iy] = data[ix*numPtsY+iy];
-
-		//use that data[ix*numPtsY+0] is the starting point of the y data at this ix
-		PolynomialT ySplineAtIX;
-		ySplineAtIX.initialize(yGridPointValues,sliceOfData);
-
-		std::vector<T> tmp = ySplineAtIX.deriviatives_at_underlying_grid_points();
-
-		for ( size_t iy = 0 ; iy < numPtsY ; ++iy){
-			yDerivatives[ix*numPtsY+iy] = tmp[iy];
-		}
-	}
-
-	//temporary array with the x and y derivatives at the grid values. Has the same ordering as the data.
-	std::vector<T> xyDerivatives(xGridPointValues.size()*numPtsY,0.0);
+			transposed[iy*numPtsX+ix] = data[ix*numPtsY+iy];
+	delegate::derivatives_of_columns<PolynomialT,T>::call(yGridPointValues,transposed,numPtsX,transposedDerivatives);
+	std::vector<T> yDerivatives(numPtsX*numPtsY);
+	for (size_t ix=0 ; ix <numPtsX ; ix++ )
+		for ( size_t iy = 0 ; iy <numPtsY ; iy++)
+			yDerivatives[ix*numPtsY+iy] = transposedDerivatives[iy*numPtsX+ix];
 
 	//Interpolate of the derivative of x along the y direction
-	for (size_t ix=0 ; ix <numPtsX ; ++ix ){
-
-		//overwrites sliceOfData which has still the correct size
-		for ( size_t iy = 0 ; iy <numPtsY ; ++iy)
-			sliceOfData[iy] = xDerivatives[ix*numPtsY+iy];
-
-		PolynomialT yPolynomOfDFByDXAtIX;
-		yPolynomOfDFByDXAtIX.initialize(yGridPointValues,sliceOfData);
-
-		std::vector<T> tmp = yPolynomOfDFByDXAtIX.deriviatives_at_underlying_grid_points();
-
-		for ( size_t iy = 0 ; iy < numPtsY ; ++iy){
-			xyDerivatives[ix*numPtsY+iy] = tmp[iy];
-		}
-	}
+	for (size_t ix=0 ; ix <numPtsX ; ix++ )
+		for ( size_t iy = 0 ; iy <numPtsY ; iy++)
+			transposed[iy*numPtsX+ix] = xDerivatives[ix*numPtsY+iy];
+	delegate::derivatives_of_columns<PolynomialT,T>::call(yGridPointValues,transposed,numPtsX,transposedDerivatives);
+	std::vector<T> xyDerivatives(numPtsX*numPtsY);
+	for (size_t ix=0 ; ix <numPtsX ; ix++ )
+		for ( size_t iy = 0 ; iy <numPtsY ; iy++)
+			xyDerivatives[ix*numPtsY+iy] = transposedDerivatives[iy*numPtsX+ix];
 
 	//we have numPtsY*xGridPointValues.size() points
 	//	which makes (numPtsY-1)*(xGridPointValues.size()-1) intervals
@@ -196,36 +173,26 @@ void BiCubicInterpolation<T>::initialize_t(std::vector<T> const& xGridPointValue
 
 	_numPolynomsX =numPtsX-1;
 	_numPolynomsY = numPtsY-1;
-	_minRangeX = *std::min_element(_gridValuesX.begin(),_gridValuesX.end());
-	_minRangeY = *std::min_element(_gridValuesY.begin(),_gridValuesY.end());
-	_maxRangeX = *std::max_element(_gridValuesX.begin(),_gridValuesX.end());
-	_maxRangeY = *std::max_element(_gridValuesY.begin(),_gridValuesY.end());
+	_minRangeX = _gridValuesX[0];
+	_minRangeY = _gridValuesY[0];
+	_maxRangeX = _gridValuesX[numPtsX-1];
+	_maxRangeY = _gridValuesY[numPtsY-1];
 	_isInit = true;
 }
 
 template<typename T>
 size_t BiCubicInterpolation<T>::find_polynomial_in_range(T x, T y) const {
+	//the polynomial index in x and y is the index of the last grid point that is not larger than x or y
+	const size_t indexX = _gridValuesX.find_interval(x);
+	const size_t indexY = _gridValuesY.find_interval(y);
+	return indexX*_numPolynomsY+indexY;
+}
 
-	//first try the last polynomial if it is in range
-	if ( _interpolatingPolynomials[_xLastAccess*_numPolynomsY + _yLastAccess].is_in_range(x,y)){
-		return _xLastAccess*_numPolynomsY + _yLastAccess;
-	}
-
-	//the polynomial index in x and y is the index of the point that is not smaller than x or y
-	//	we use <algorithm> lower_bound which gives the iterator to the first element that does not compare less.
-	//	The result is thus equivalent to the index of the upper point of the polynomial, except equality which is
-	//		used in a different convention and we have to account for this
-	typename std::set<T>::const_iterator ptrToLBoundX;
-	ptrToLBoundX = _gridValuesX.lower_bound(x);
-	int indexX = std::distance(_gridValuesX.begin(),ptrToLBoundX)-1;
-	if ( *ptrToLBoundX == x)
-		indexX += 1;
-	typename std::set<T>::const_iterator ptrToLBoundY;
-	ptrToLBoundY = _gridValuesY.lower_bound(y);
-	int indexY = std::distance(_gridValuesY.begin(),ptrToLBoundY)-1;
-	if ( *ptrToLBoundY == y)
-		indexY += 1;
-	return static_cast<size_t>(indexX)*_numPolynomsY+static_cast<size_t>(indexY);
+template<typename T>
+size_t BiCubicInterpolation<T>::find_polynomial_in_range(T x, T y, Cursor & cursor) const {
+	const size_t indexX = _gridValuesX.find_interval(x,cursor.x);
+	const size_t indexY = _gridValuesY.find_interval(y,cursor.y);
+	return indexX*_numPolynomsY+indexY;
 }
 
 template<typename T>
@@ -245,6 +212,16 @@ void BiCubicInterpolation<T>::evaluate_derivative(T x, T y,T &gradX, T &gradY) c
 	return _interpolatingPolynomials[find_polynomial_in_range(x,y)].evaluate_derivative(x,y,gradX,gradY);
 }
 
+template<typename T>
+void BiCubicInterpolation<T>::evaluate(T x, T y,T &dataInterpolation, Cursor & cursor) const {
+	return _interpolatingPolynomials[find_polynomial_in_range(x,y,cursor)].evaluate(x,y,dataInterpolation);
+}
+
+template<typename T>
+void BiCubicInterpolation<T>::evaluate_derivative(T x, T y,T &gradX, T &gradY, Cursor & cursor) const {
+	return _interpolatingPolynomials[find_polynomial_in_range(x,y,cursor)].evaluate_derivative(x,y,gradX,gradY);
+}
+
 template<typename T>
 void BiCubicInterpolation<T>::data_range(T &xMin, T &xMax, T &yMin, T &yMax) const {
 	xMin = _minRangeX;
@@ -254,6 +231,27 @@ void BiCubicInterpolation<T>::data_range(T &xMin, T &xMax, T &yMin, T &yMax) con
 }
 
 
+template<typename T>
+size_t BiCubicInterpolation<T>::num_polynomials_x() const {
+	return _numPolynomsX;
+}
+
+template<typename T>
+size_t BiCubicInterpolation<T>::num_polynomials_y() const {
+	return _numPolynomsY;
+}
+
+template<typename T>
+BiCubicPolynomial<T> const& BiCubicInterpolation<T>::get_polynomial(size_t ix, size_t iy) const {
+#ifdef DEBUG_BUILD
+	if ( (ix >= _numPolynomsX) or (iy >= _numPolynomsY) ){
+		gslpp::error_handling::Error("Access to polynomial "+std::to_string(ix)+","+std::to_string(iy)+" out of range",
+				gslpp::error_handling::Error::OUT_OF_BOUNDS);
+	}
+#endif
+	return _interpolatingPolynomials[ix*_numPolynomsY + iy];
+}
+
 template<typename T>
 T BiCubicInterpolation<T>::min_range_x() const {
 	return _minRangeX;
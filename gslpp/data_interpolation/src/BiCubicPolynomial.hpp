@@ -41,10 +41,11 @@ void BiCubicPolynomial<T>::initialize(T f00, T f10, T f01, T f11,
 	T intervalLengthY = yMax-yMin;
 
 	//scale to the unit interval f(x,y)=fs(x',y') ; x' = (x-xMin)/(xMax-xMin) and y the same
+	//	such that dfs/dx' = df/dx * (xMax-xMin)
 	for (size_t i = 0 ; i < 4 ; i++){
-		functionValues[i+4] = functionValues[i+4] /intervalLengthX; // df/dx
-		functionValues[i+8] = functionValues[i+8] /intervalLengthY; // df/dy
-		functionValues[i+12]= functionValues[i+12]/intervalLengthY/intervalLengthX; // ddf/dydx
+		functionValues[i+4] = functionValues[i+4] *intervalLengthX; // df/dx
+		functionValues[i+8] = functionValues[i+8] *intervalLengthY; // df/dy
+		functionValues[i+12]= functionValues[i+12]*intervalLengthY*intervalLengthX; // ddf/dydx
 	}
 
 	//analytic inverse matrix to determine the coefficients
@@ -132,49 +133,38 @@ void BiCubicPolynomial<T>::evaluate(T x, T y, T &dataValue) const {
 
 template<typename T>
 void BiCubicPolynomial<T>::evaluate_derivative(T x, T y, T &gradX, T &gradY) const {
-	T deltaX = _maxX-_minX;
-	T deltaY = _maxY-_minY;
 	x = (x -_minX) ;
 	y = (y -_minY) ;
 
-	//The coefficients are scaled by  1/deltaX with the respective power n of x.
-	//	For example _coefficients[1] is scaled by 1/deltaX and _coefficients[10] by (1/deltaX)^2.
-	//	Since, here, the power of x is reduced by one we need to multiply by deltaX. Furthermore,
-	//	taking derivative to the unit interval  means to cast d/dx -> deltaX*d/dx. Thus we multiply
-	//	by deltaX*deltaX. Same with y.
+	//The coefficients are those of the powers of x-xMin and y-yMin, thus no scaling is needed.
 	gradX =( ( _coefficients[ 1] + 2.0*_coefficients[ 2]*x + 3.0*_coefficients[ 3]*x*x)       +
 			 ( _coefficients[ 5] + 2.0*_coefficients[ 6]*x + 3.0*_coefficients[ 7]*x*x)*y     +
 			 ( _coefficients[ 9] + 2.0*_coefficients[10]*x + 3.0*_coefficients[11]*x*x)*y*y   +
-			 ( _coefficients[13] + 2.0*_coefficients[14]*x + 3.0*_coefficients[15]*x*x)*y*y*y ) * deltaX*deltaX  ;
+			 ( _coefficients[13] + 2.0*_coefficients[14]*x + 3.0*_coefficients[15]*x*x)*y*y*y );
 
 	gradY =( ( _coefficients[ 4] + _coefficients[ 5]*x + _coefficients[ 6]*x*x + _coefficients[ 7]*x*x*x)			+
 			 ( _coefficients[ 8] + _coefficients[ 9]*x + _coefficients[10]*x*x + _coefficients[11]*x*x*x)*2.0*y 	+
-			 ( _coefficients[12] + _coefficients[13]*x + _coefficients[14]*x*x + _coefficients[15]*x*x*x)*3.0*y*y	)*deltaY*deltaY;
+			 ( _coefficients[12] + _coefficients[13]*x + _coefficients[14]*x*x + _coefficients[15]*x*x*x)*3.0*y*y	);
 }
 
 
 template<typename T>
 void BiCubicPolynomial<T>::evaluate_second_derivative(T x, T y, T &Jxx, T &Jxy, T &Jyy) const {
-	T deltaX = _maxX-_minX;
-	T deltaY = _maxY-_minY;
 	x = (x -_minX) ;
 	y = (y -_minY) ;
 
-	//See comment in BiCubicPolynomial<T>::evaluate_derivative for the occurrence of deltaX*deltaX*deltaX*deltaX.
+	//See comment in BiCubicPolynomial<T>::evaluate_derivative.
 	Jxx = ( ( 2.0*_coefficients[ 2] + 6.0*_coefficients[ 3]*x)       	+
 			( 2.0*_coefficients[ 6] + 6.0*_coefficients[ 7]*x)*y    	+
 			( 2.0*_coefficients[10] + 6.0*_coefficients[11]*x)*y*y   	+
-			( 2.0*_coefficients[14] + 6.0*_coefficients[15]*x)*y*y*y )	*
-			deltaX*deltaX*deltaX*deltaX;
+			( 2.0*_coefficients[14] + 6.0*_coefficients[15]*x)*y*y*y );
 
 	Jxy = ( ( _coefficients[ 5] + 2.0*_coefficients[ 6]*x + 3.0*_coefficients[ 7]*x*x)     		+
 			( _coefficients[ 9] + 2.0*_coefficients[10]*x + 3.0*_coefficients[11]*x*x)*2.0*y   	+
-			( _coefficients[13] + 2.0*_coefficients[14]*x + 3.0*_coefficients[15]*x*x)*3.0*y*y )*
-			deltaX*deltaX*deltaY*deltaY;
+			( _coefficients[13] + 2.0*_coefficients[14]*x + 3.0*_coefficients[15]*x*x)*3.0*y*y );
 
 	Jyy = ( ( _coefficients[ 8] + _coefficients[ 9]*x + _coefficients[10]*x*x + _coefficients[11]*x*x*x)*2.0 	 +
-			( _coefficients[12] + _coefficients[13]*x + _coefficients[14]*x*x + _coefficients[15]*x*x*x)*6.0*y	)*
-			deltaY*deltaY*deltaY*deltaY;
+			( _coefficients[12] + _coefficients[13]*x + _coefficients[14]*x*x + _coefficients[15]*x*x*x)*6.0*y	);
 }
 
 template<typename T>
@@ -213,5 +203,11 @@ bool BiCubicPolynomial<T>::is_init() const{
 	return _isIninitalized;
 }
 
+template<typename T>
+void BiCubicPolynomial<T>::power_basis_coefficients(T (&coefficients)[16]) const {
+	for (size_t i = 0 ; i < 16 ; i++)
+		coefficients[i] = _coefficients[i];
+}
+
 } /* namespace data_interpolation */
 } /* namespace gslpp */
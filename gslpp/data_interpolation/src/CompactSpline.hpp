@@ -0,0 +1,139 @@
+/*
+ * CompactSpline.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/data_interpolation/CompactSpline.h"
+#include "gslpp/error_handling/Error.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+template<typename T>
+CompactSpline<T>::CompactSpline() {
+	this->clear();
+}
+
+template<typename T>
+template<class spline>
+CompactSpline<T>::CompactSpline(spline const& source) {
+	this->initialize(source);
+}
+
+template<typename T>
+template<class spline>
+void CompactSpline<T>::initialize(spline const& source) {
+	this->clear();
+	const size_t numSegments = source.num_polynomials();
+	if ( numSegments == 0 )
+		gslpp::error_handling::Error("Cannot copy a spline without polynomials",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+
+	std::vector<T> knots(numSegments+1);
+	_c0.resize(numSegments);
+	_c1.resize(numSegments);
+	_c2.resize(numSegments);
+	_c3.resize(numSegments);
+	for ( size_t i = 0 ; i < numSegments; ++i) {
+		T coefficients[4];
+		segment_coefficients(source.get_polynomial(i),coefficients);
+		knots[i] = source.get_polynomial(i).min_range();
+		_c0[i] = coefficients[0];
+		_c1[i] = coefficients[1];
+		_c2[i] = coefficients[2];
+		_c3[i] = coefficients[3];
+	}
+	knots.back() = source.get_polynomial(numSegments-1).max_range();
+
+	_knots.assign(knots);
+	this->set_range_of_definition(knots.front(),knots.back());
+	this->set_init_state(true);
+}
+
+template<typename T>
+template<class polynomial>
+void CompactSpline<T>::segment_coefficients(polynomial const& p, T (&coefficients)[4]) {
+	//the polynomial is in the normalized variable t = (x-x_i)/h, thus c_k(Delta) = c_k(t)/h^k
+	p.power_basis_coefficients(coefficients);
+	const T inverseLength = T(1)/p.interval_length();
+	coefficients[1] *= inverseLength;
+	coefficients[2] *= inverseLength*inverseLength;
+	coefficients[3] *= inverseLength*inverseLength*inverseLength;
+}
+
+template<typename T>
+void CompactSpline<T>::clear() {
+	_knots.clear();
+	_c0.clear();
+	_c1.clear();
+	_c2.clear();
+	_c3.clear();
+	this->set_init_state(false);
+}
+
+template<typename T>
+size_t CompactSpline<T>::num_segments() const {
+	return _c0.size();
+}
+
+template<typename T>
+size_t CompactSpline<T>::find_segment(T x) const {
+#ifdef DEBUG_BUILD
+	if ( _c0.empty() )
+		gslpp::error_handling::Error("Compact spline is not init while trying to evaluate",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+	if ( not this->x_is_in_range(x) )
+		gslpp::error_handling::Error( "Cannot find a segment in range for x that is out of range!" ,
+				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+#endif
+	return _knots.find_interval(x);
+}
+
+template<typename T>
+void CompactSpline<T>::evaluate(T x, T &value) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	value = _c0[i] + delta*(_c1[i] + delta*(_c2[i] + delta*_c3[i]));
+}
+
+template<typename T>
+void CompactSpline<T>::evaluate(T x, T &value, T &derivative) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	value = _c0[i] + delta*(_c1[i] + delta*(_c2[i] + delta*_c3[i]));
+	derivative = _c1[i] + delta*(2*_c2[i] + delta*3*_c3[i]);
+}
+
+template<typename T>
+void CompactSpline<T>::evaluate(T x, T &value, T &derivative, T &second_derivative) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	value = _c0[i] + delta*(_c1[i] + delta*(_c2[i] + delta*_c3[i]));
+	derivative = _c1[i] + delta*(2*_c2[i] + delta*3*_c3[i]);
+	second_derivative = 2*_c2[i] + delta*6*_c3[i];
+}
+
+template<typename T>
+void CompactSpline<T>::evaluate_derivative(T x, T &derivative) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	derivative = _c1[i] + delta*(2*_c2[i] + delta*3*_c3[i]);
+}
+
+template<typename T>
+void CompactSpline<T>::evaluate_second_derivative(T x, T &second_derivative) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	second_derivative = 2*_c2[i] + delta*6*_c3[i];
+}
+
+template<typename T>
+void CompactSpline<T>::evaluate(T const * xs, T * values, size_t n) const {
+	for ( size_t k = 0 ; k < n; ++k)
+		this->evaluate(xs[k],values[k]);
+}
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
@@ -5,24 +5,27 @@
  *      Author: alinsch
  */
 #include "gslpp/data_interpolation/CubeSpline.h"
+#include <algorithm>
+#include <string>
 
 namespace gslpp {
 namespace data_interpolation {
 
 template<typename T, class Polynom>
-CubeSpline<T,Polynom>::CubeSpline() : BaseSpline<CubeSpline<T>,T,Polynom>(){
+CubeSpline<T,Polynom>::CubeSpline() : BaseSpline<CubeSpline<T>,T,Polynom>(), _updateWindow(48){
 }
 
 template<typename T, class Polynom>
 CubeSpline<T,Polynom>::CubeSpline(std::vector<T> const& data, std::vector<T> const& mesh)
-	: BaseSpline<CubeSpline<T>,T,Polynom>() {
+	: BaseSpline<CubeSpline<T>,T,Polynom>(), _updateWindow(48) {
 }
 
 template<typename T, class Polynom>
 void CubeSpline<T,Polynom>::clear(){
-	_splineMatrix.clear();
-	_splineVector.clear();
 	BaseSpline<CubeSpline<T>,T,Polynom>::clear();
+	_mesh.clear();
+	_data.clear();
+	_derivatives.clear();
 }
 
 template<typename T, class Polynom>
@@ -35,82 +38,123 @@ void CubeSpline<T,Polynom>::initialize(std::vector<T> const& mesh, std::vector<T
 #endif
 	this->clear();
 	this->set_range_of_definition(mesh.front(),mesh.back());
-	this->build_spline_matrix(data,mesh);
-	this->find_derivatives_and_build_polynominals(data,mesh);
+
+	//insert the data into the internal mesh
+	this->insert_grid(mesh);
+
+	std::vector<T> derivatives;
+	MultiSpline<T>::solve_for_derivatives(mesh,data,1,derivatives);
+	for (size_t ipol=0;ipol+1<mesh.size();ipol++)
+		this->insert_polynom(Polynom(mesh[ipol],mesh[ipol+1],data[ipol],data[ipol+1],
+				derivatives[ipol],derivatives[ipol+1]));
 	this->set_init_state(true);
 }
 
 template<typename T, class Polynom>
-void CubeSpline<T,Polynom>::build_spline_matrix( std::vector<T> const& data, std::vector<T> const& mesh ){
-#ifdef DEBUG_BUILD
-	if ( ( data.size() != mesh.size() ) or ( mesh.size() <= 1 ) ) {
-		gslpp::error_handling::Error( "Input data for spline matrix generation is rubbish" ,
-				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
-	}
-#endif
+void CubeSpline<T,Polynom>::append(T x, T y) {
+	if ( this->num_polynomials() == 0 )
+		gslpp::error_handling::Error( "Appending a point to a spline with less than 2 points" ,
+				gslpp::error_handling::Error::INPUT_ERROR);
+	this->make_modifiable();
+	_mesh.push_back(x);
+	_data.push_back(y);
+	_derivatives.push_back(T(0));
+	this->append_grid_point(x);
+	const size_t lastPoint = _mesh.size()-1;
+	this->solve_in_window(( lastPoint > _updateWindow ? lastPoint-_updateWindow : 0 ),lastPoint);
+}
 
-	//insert the data into the internal mesh
-	this->insert_grid(mesh);
+template<typename T, class Polynom>
+void CubeSpline<T,Polynom>::pop_front() {
+	if ( this->num_polynomials() < 2 )
+		gslpp::error_handling::Error( "Removing a point from a spline with less than 3 points" ,
+				gslpp::error_handling::Error::INPUT_ERROR);
+	this->make_modifiable();
+	_mesh.pop_front();
+	_data.pop_front();
+	_derivatives.pop_front();
+	this->remove_first_grid_point();
+	this->solve_in_window(0,std::min(_updateWindow,_mesh.size()-1));
+}
 
-	using std::pow;
-	_splineMatrixDim = mesh.size();
-
-	//Create the spline matrix
-	_splineMatrix.assign(_splineMatrixDim*_splineMatrixDim,0.0);
-	for (size_t i=1;i<_splineMatrixDim-1;i++){
-		//element i,i-1
-		_splineMatrix[i*_splineMatrixDim+i-1] = 1.0/(mesh[i]-mesh[i-1]);
-		//element i,i
-		_splineMatrix[i*_splineMatrixDim+i] = 2.0*(
-				1.0/(mesh[i]-mesh[i-1]) + 1.0/(mesh[i+1]-mesh[i]) );
-		//element i,+i
-		_splineMatrix[i*_splineMatrixDim+i+1] = 1.0/(mesh[i+1]-mesh[i]);
-	}
-	//element 0,0
-	_splineMatrix[0] = 2.0/(mesh[1]-mesh[0]);
-	//element 0,1
-	_splineMatrix[1] = 1.0/(mesh[1]-mesh[0]);
-	//element N,N-1
-	_splineMatrix[(_splineMatrixDim-1)*_splineMatrixDim+_splineMatrixDim-2]
-	              = 1.0/(mesh[_splineMatrixDim-1]-mesh[_splineMatrixDim-2]);
-	//element N,N
-	_splineMatrix[(_splineMatrixDim-1)*_splineMatrixDim+_splineMatrixDim-1]
-	              = 2.0/(mesh[_splineMatrixDim-1]-mesh[_splineMatrixDim-2]);
-
-	//create the spline vector
-	_splineVector.assign(_splineMatrixDim,0.0);
-	_splineVector[0] = 3.0*(data[1]-data[0])/pow(mesh[1]-mesh[0],2);
-	for (size_t i=1;i<_splineMatrixDim-1;i++){
-		_splineVector[i] = 3.0*((data[i]-data[i-1])/pow(mesh[i]-mesh[i-1],2)
-				+(data[i+1]-data[i])/pow(mesh[i+1]-mesh[i],2));
+template<typename T, class Polynom>
+void CubeSpline<T,Polynom>::update(size_t i, T y) {
+	if ( (this->num_polynomials() == 0) or (i > this->num_polynomials()) )
+		gslpp::error_handling::Error( "Update of the point "+std::to_string(i)+" that is not in the spline" ,
+				gslpp::error_handling::Error::OUT_OF_BOUNDS);
+	this->make_modifiable();
+	_data[i] = y;
+	this->solve_in_window(( i > _updateWindow ? i-_updateWindow : 0 ),
+			std::min(i+_updateWindow,_mesh.size()-1));
+}
+
+template<typename T, class Polynom>
+void CubeSpline<T,Polynom>::set_update_window(size_t numPoints) {
+	if ( numPoints == 0 )
+		gslpp::error_handling::Error( "The update window must contain at least one point" ,
+				gslpp::error_handling::Error::INPUT_ERROR);
+	_updateWindow = numPoints;
+}
+
+template<typename T, class Polynom>
+size_t CubeSpline<T,Polynom>::get_update_window() const {
+	return _updateWindow;
+}
+
+template<typename T, class Polynom>
+void CubeSpline<T,Polynom>::make_modifiable() {
+	if ( not _mesh.empty() )
+		return;
+	//the mesh and the data are exact in the polynomials. The derivatives are solved for again,
+	//	since the polynomials only give them up to rounding.
+	const size_t numPolynomials = this->num_polynomials();
+	std::vector<T> mesh(numPolynomials+1);
+	std::vector<T> data(numPolynomials+1);
+	for (size_t ipol=0;ipol<numPolynomials;ipol++){
+		mesh[ipol] = this->get_polynomial(ipol).min_range();
+		data[ipol] = this->get_polynomial(ipol).value_at_range_min();
 	}
-	_splineVector[_splineMatrixDim-1] = 3.0*(data[_splineMatrixDim-1]-data[_splineMatrixDim-2])
-			/pow(mesh[_splineMatrixDim-1]-mesh[_splineMatrixDim-2],2);
+	mesh[numPolynomials] = this->get_polynomial(numPolynomials-1).max_range();
+	data[numPolynomials] = this->get_polynomial(numPolynomials-1).value_at_range_max();
+	std::vector<T> derivatives;
+	MultiSpline<T>::solve_for_derivatives(mesh,data,1,derivatives);
+	_mesh.assign(mesh.begin(),mesh.end());
+	_data.assign(data.begin(),data.end());
+	_derivatives.assign(derivatives.begin(),derivatives.end());
 }
 
 template<typename T, class Polynom>
-void CubeSpline<T,Polynom>::find_derivatives_and_build_polynominals(
-		std::vector<T> const& data, std::vector<T> const& mesh){
+void CubeSpline<T,Polynom>::solve_in_window(size_t first, size_t last) {
+	std::vector<T> mesh(_mesh.begin()+first,_mesh.begin()+last+1);
+	std::vector<T> data(_data.begin()+first,_data.begin()+last+1);
+	std::vector<T> derivatives;
+	//inside the mesh, the derivatives at the border of the window are kept
+	MultiSpline<T>::solve_for_derivatives(mesh,data,1,derivatives,
+			( first > 0 ? &_derivatives[first] : nullptr ),
+			( last+1 < _mesh.size() ? &_derivatives[last] : nullptr ));
+	std::copy(derivatives.begin(),derivatives.end(),_derivatives.begin()+first);
+	this->build_polynominals(first,last-1);
+}
+
+template<typename T, class Polynom>
+void CubeSpline<T,Polynom>::build_polynominals(size_t first, size_t last){
 #ifdef DEBUG_BUILD
-	if ( ( data.size() != mesh.size() ) or
-			( mesh.size()*mesh.size() != _splineMatrix.size() ) or
-			( mesh.size() <= 1 ) ) {
+	if ( ( _data.size() != _mesh.size() ) or
+			( _mesh.size() != _derivatives.size() ) or
+			( last+1 >= _mesh.size() ) ) {
 		gslpp::error_handling::Error( "Input data for spline matrix generation is rubbish" ,
 				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
 	}
 #endif
-	gslpp::linear_algebra::LinearAlgebra<T>::invert_square_matrix(_splineMatrix);
-	std::vector<T> vectorOfDerivatives(_splineMatrixDim,0.0);
-	for (size_t i=0;i<_splineMatrixDim;i++){
-		for (size_t j=0;j<_splineMatrixDim;j++)
-			vectorOfDerivatives[i] += _splineMatrix[i*_splineMatrixDim + j]*_splineVector[j];
-	}
-	for (size_t ipol=0;ipol< _splineMatrixDim - 1 ;ipol++){
+	for (size_t ipol=first;ipol<=last;ipol++){
 
 		// construct a polynomial and insert into the container
-		Polynom p(mesh[ipol],mesh[ipol+1],data[ipol],data[ipol+1],
-				vectorOfDerivatives[ipol],vectorOfDerivatives[ipol+1]);
-		this->insert_polynom(p);
+		Polynom p(_mesh[ipol],_mesh[ipol+1],_data[ipol],_data[ipol+1],
+				_derivatives[ipol],_derivatives[ipol+1]);
+		if ( ipol < this->num_polynomials() )
+			this->replace_polynom(ipol,p);
+		else
+			this->insert_polynom(p);
 	}
 }
 
@@ -45,6 +45,16 @@ void CubicPolynomial<T>::evaluate_second_derivative(T x, T &value) const {
 	value = 2*(_b-2*_a+(_a-_b)*3*t)/std::pow(this->interval_length(),2);
 }
 
+template<typename T>
+T CubicPolynomial<T>::value_at_range_min() const {
+	return _y1;
+}
+
+template<typename T>
+T CubicPolynomial<T>::value_at_range_max() const {
+	return _y2;
+}
+
 template<typename T>
 T CubicPolynomial<T>::derivative_at_range_min() const {
 	return (_y2-_y1+_a)/this->interval_length();
@@ -55,5 +65,14 @@ T CubicPolynomial<T>::derivative_at_range_max() const {
 	return (_y2-_y1-_b)/this->interval_length();
 }
 
+template<typename T>
+void CubicPolynomial<T>::power_basis_coefficients(T (&coefficients)[4]) const {
+	//expand t*(1-t)*(_a*(1-t)+_b*t)
+	coefficients[0] = _y1;
+	coefficients[1] = _y2 - _y1 + _a;
+	coefficients[2] = _b - 2*_a;
+	coefficients[3] = _a - _b;
+}
+
 } /* namespace data_interpolation */
 } /* namespace gslpp */
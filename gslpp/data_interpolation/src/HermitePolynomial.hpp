@@ -121,6 +121,16 @@ T HermitePolynomial<T>::ddh11(T t) const {
 }
 
 
+template<typename T>
+T HermitePolynomial<T>::value_at_range_min() const {
+	return _coefficientFAtZero;
+}
+
+template<typename T>
+T HermitePolynomial<T>::value_at_range_max() const {
+	return _coefficientFAtOne;
+}
+
 template<typename T>
 T HermitePolynomial<T>::derivative_at_range_min() const {
 	return _coefficientdFAtZero;
@@ -131,5 +141,16 @@ T HermitePolynomial<T>::derivative_at_range_max() const {
 	return _coefficientdFAtOne;
 }
 
+template<typename T>
+void HermitePolynomial<T>::power_basis_coefficients(T (&coefficients)[4]) const {
+	//collect the powers of t in the Hermite basis functions h00, h10, h01 and h11
+	const T scaledDFAtZero = _coefficientdFAtZero * this->interval_length();
+	const T scaledDFAtOne = _coefficientdFAtOne * this->interval_length();
+	coefficients[0] = _coefficientFAtZero;
+	coefficients[1] = scaledDFAtZero;
+	coefficients[2] = 3*(_coefficientFAtOne - _coefficientFAtZero) - 2*scaledDFAtZero - scaledDFAtOne;
+	coefficients[3] = 2*(_coefficientFAtZero - _coefficientFAtOne) + scaledDFAtZero + scaledDFAtOne;
+}
+
 }; /* namespace data_interpolation */
 }; /* namespace gslpp */
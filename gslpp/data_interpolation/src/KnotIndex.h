@@ -0,0 +1,184 @@
+/*
+ * KnotIndex.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_DATA_INTERPOLATION_KNOTINDEX_H_
+#define GSLPP_DATA_INTERPOLATION_KNOTINDEX_H_
+
+#include <vector>
+#include <cstddef>
+
+namespace gslpp {
+namespace data_interpolation {
+
+/**	The interval of the last lookup in a KnotIndex, kept by the caller per thread or per trajectory.
+ *
+ * 	A lookup with a cursor starts from the previous interval, see KnotIndex.find_interval(T,KnotCursor&).
+ */
+struct KnotCursor {
+	KnotCursor() : interval(0) {};
+
+	size_t interval;
+};
+
+/**	The strictly increasing knots of a mesh in a contiguous array with a search for the interval of a point.
+ *
+ * 	The search is a binary search where the comparison selects the next base with a conditional move
+ * 	instead of a branch, such that it takes \f$ \lceil \log_2 n \rceil \f$ steps without mispredictions.
+ *
+ * 	Upon assignment the knots are checked for a uniform or a log-uniform spacing, unless the spacing is given
+ * 	along with the knots in external storage. For those meshes the interval is
+ * 	computed directly as \f$ \lfloor (x-x_0)/h \rfloor \f$, or from the logarithms, without a search.
+ * 	The estimate is then compared to the two adjacent knots and corrected, such that the result
+ * 	is always identical to the one of the search, in particular on the knots themselves.
+ */
+template<typename T>
+class KnotIndex {
+public:
+	/**	The spacing of the knots detected upon assignment. */
+	enum MeshType { general, uniform, logUniform };
+
+	/**	Empty constructor of an index without knots.
+	 */
+	KnotIndex();
+
+	/**	Set the knots.
+	 *
+	 * On DEBUG_BUILD the method checks that the knots are strictly increasing.
+	 *
+	 * @param strictlyIncreasingKnots The knots \f$x_i < x_{i+1}\f$
+	 */
+	void assign(std::vector<T> const& strictlyIncreasingKnots);
+
+	/**	Use knots in external storage without a copy, e.g. in a file that is mapped into memory.
+	 *
+	 * The storage must stay valid as long as the index is used, and the index cannot be modified
+	 * with push_back or pop_front. On DEBUG_BUILD the method checks that the knots are strictly increasing.
+	 *
+	 * @param strictlyIncreasingKnots Pointer to the knots \f$x_i < x_{i+1}\f$
+	 * @param numKnots The number of knots.
+	 */
+	void assign_view(T const * strictlyIncreasingKnots, size_t numKnots);
+
+	/**	Use knots in external storage without a copy and with a spacing that was detected before.
+	 *
+	 * Unlike KnotIndex.assign_view(T const *,size_t) this does not read the knots, such that the assignment
+	 * takes O(1), e.g. for a table file that stores the spacing along with the knots.
+	 * On DEBUG_BUILD the method checks that the knots are strictly increasing and have the given spacing.
+	 *
+	 * @param strictlyIncreasingKnots Pointer to the knots \f$x_i < x_{i+1}\f$
+	 * @param numKnots The number of knots.
+	 * @param meshType The spacing of the knots as returned by KnotIndex.mesh_type().
+	 * @param origin The origin as returned by KnotIndex.origin().
+	 * @param inverseSpacing The inverse spacing as returned by KnotIndex.inverse_spacing().
+	 */
+	void assign_view(T const * strictlyIncreasingKnots, size_t numKnots,
+			MeshType meshType, T origin, T inverseSpacing);
+
+	/**	Append a knot.
+	 *
+	 * A uniform or log-uniform mesh keeps its type if the knot is at its place within the tolerance.
+	 *
+	 * @param x The knot which must be larger than the last one.
+	 */
+	void push_back(T x);
+
+	/**	Remove the first knot.
+	 *
+	 * The storage is compacted once the removed knots are the larger part of it, which makes the
+	 * removal amortized O(1).
+	 */
+	void pop_front();
+
+	/**	Remove all knots.
+	 */
+	void clear();
+
+	/**	@return True if there are no knots */
+	bool empty() const;
+
+	/**	@return The number of knots */
+	size_t size() const;
+
+	/**	@return The knot i */
+	T operator[] (size_t i) const;
+
+	/**	@return The pointer to the contiguous knots */
+	T const * data() const;
+
+	/**	@return The spacing of the knots detected upon assignment */
+	MeshType mesh_type() const;
+
+	/**	@return The first knot of a uniform mesh or its logarithm for a log-uniform mesh */
+	T origin() const;
+
+	/**	@return The inverse of the distance of the knots of a uniform mesh or of their logarithms for a log-uniform mesh */
+	T inverse_spacing() const;
+
+	/**	Find the interval \f$[x_i,x_{i+1})\f$ that contains x.
+	 *
+	 * Points below the first knot give the first interval and points at or above the last knot give the last interval.
+	 * There must be at least two knots.
+	 *
+	 * @param x The point.
+	 * @return The index i of the lower knot of the interval.
+	 */
+	size_t find_interval(T x) const;
+
+	/**	Find the interval \f$[x_i,x_{i+1})\f$ that contains x starting from the interval of the cursor.
+	 *
+	 * Unless the mesh is uniform or log-uniform, the search steps away from the interval of the cursor
+	 * in steps of 1, 2, 4, ... intervals until x is bracketed and then bisects the bracket.
+	 * A position that is m intervals away from the last one is thus found in \f$ O(\log m) \f$ steps.
+	 * The result is the same as for KnotIndex.find_interval(T).
+	 *
+	 * @param x The point.
+	 * @param cursor The interval of the last lookup. On output the interval of x.
+	 * @return The index i of the lower knot of the interval.
+	 */
+	size_t find_interval(T x, KnotCursor & cursor) const;
+private:
+
+	std::vector<T> _knots;
+
+	//the knots in external storage if not null
+	T const * _view;
+
+	size_t _viewSize;
+
+	//the knots before _first were removed with pop_front
+	size_t _first;
+
+	MeshType _meshType;
+
+	//x_0 and 1/h in the variable that is uniform, that is x or log(x)
+	T _origin;
+
+	T _inverseSpacing;
+
+	//the spacing in the variable that is uniform may deviate from the exact value by this fraction of h
+	static constexpr double _uniformTolerance = 0.01;
+
+	//set the view without a check of the spacing
+	void set_view(T const * strictlyIncreasingKnots, size_t numKnots);
+
+	void detect_mesh_type();
+
+	bool is_uniform(bool logarithmic) const;
+
+	//the last interval in [begin,end) with a lower knot not larger than x, or begin
+	size_t find_interval_by_search(T x, size_t begin, size_t end) const;
+
+	size_t find_interval_by_hunt(T x, size_t start) const;
+
+	size_t find_interval_by_spacing(T x) const;
+};
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
+
+#include "gslpp/data_interpolation/src/KnotIndex.hpp"
+#endif /* GSLPP_DATA_INTERPOLATION_KNOTINDEX_H_ */
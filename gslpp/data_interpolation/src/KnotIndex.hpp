@@ -0,0 +1,307 @@
+/*
+ * KnotIndex.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/data_interpolation/src/KnotIndex.h"
+#include "gslpp/error_handling/Error.h"
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+namespace gslpp {
+namespace data_interpolation {
+
+template<typename T>
+KnotIndex<T>::KnotIndex() : _view(nullptr), _viewSize(0), _first(0), _meshType(general), _origin(0), _inverseSpacing(0) {
+}
+
+template<typename T>
+void KnotIndex<T>::assign(std::vector<T> const& strictlyIncreasingKnots) {
+#ifdef DEBUG_BUILD
+	for ( size_t i = 1 ; i < strictlyIncreasingKnots.size() ; ++i){
+		if ( not (strictlyIncreasingKnots[i-1] < strictlyIncreasingKnots[i]) ){
+			gslpp::error_handling::Error("Input grid not sorted",
+					gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+		}
+	}
+#endif
+	_knots = strictlyIncreasingKnots;
+	_first = 0;
+	_view = nullptr;
+	_viewSize = 0;
+	this->detect_mesh_type();
+}
+
+template<typename T>
+void KnotIndex<T>::assign_view(T const * strictlyIncreasingKnots, size_t numKnots) {
+	this->set_view(strictlyIncreasingKnots,numKnots);
+	this->detect_mesh_type();
+}
+
+template<typename T>
+void KnotIndex<T>::assign_view(T const * strictlyIncreasingKnots, size_t numKnots,
+		MeshType meshType, T origin, T inverseSpacing) {
+	this->set_view(strictlyIncreasingKnots,numKnots);
+#ifdef DEBUG_BUILD
+	this->detect_mesh_type();
+	if ( _meshType != meshType ){
+		gslpp::error_handling::Error("The given spacing of the knots is not the one of the knots",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	}
+#endif
+	_meshType = meshType;
+	_origin = origin;
+	_inverseSpacing = inverseSpacing;
+}
+
+template<typename T>
+void KnotIndex<T>::set_view(T const * strictlyIncreasingKnots, size_t numKnots) {
+#ifdef DEBUG_BUILD
+	for ( size_t i = 1 ; i < numKnots ; ++i){
+		if ( not (strictlyIncreasingKnots[i-1] < strictlyIncreasingKnots[i]) ){
+			gslpp::error_handling::Error("Input grid not sorted",
+					gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+		}
+	}
+#endif
+	_knots.clear();
+	_first = 0;
+	_view = strictlyIncreasingKnots;
+	_viewSize = numKnots;
+}
+
+template<typename T>
+void KnotIndex<T>::push_back(T x) {
+#ifdef DEBUG_BUILD
+	if ( _view != nullptr ){
+		gslpp::error_handling::Error("Modification of knots in external storage",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	}
+	if ( (not this->empty()) and (not ((*this)[this->size()-1] < x)) ){
+		gslpp::error_handling::Error("Appended knot is not larger than the last knot",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	}
+#endif
+	_knots.push_back(x);
+	if ( this->size() <= 3 ) {
+		this->detect_mesh_type();
+	} else if ( _meshType != general ) {
+		//keep the spacing of the mesh and check that the new knot is at its place
+		const T u = (_meshType == uniform ? x : std::log(x));
+		const T h = T(1)/_inverseSpacing;
+		//the negated comparison also catches the logarithm of a knot that is not positive
+		if ( not (std::fabs(u - (_origin + h*T(this->size()-1))) <= h*T(_uniformTolerance)) )
+			_meshType = general;
+	}
+}
+
+template<typename T>
+void KnotIndex<T>::pop_front() {
+#ifdef DEBUG_BUILD
+	if ( _view != nullptr ){
+		gslpp::error_handling::Error("Modification of knots in external storage",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	}
+	if ( this->empty() ){
+		gslpp::error_handling::Error("Removing a knot from an empty index",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+	}
+#endif
+	++_first;
+	//the removed knots are erased once they are the larger part of the storage, which is amortized O(1)
+	if ( 2*_first > _knots.size() ) {
+		_knots.erase(_knots.begin(),_knots.begin()+_first);
+		_first = 0;
+	}
+	if ( this->size() < 3 )
+		_meshType = general;
+	else if ( _meshType != general )
+		_origin += T(1)/_inverseSpacing;
+}
+
+template<typename T>
+void KnotIndex<T>::clear() {
+	_knots.clear();
+	_first = 0;
+	_view = nullptr;
+	_viewSize = 0;
+	_meshType = general;
+}
+
+template<typename T>
+bool KnotIndex<T>::empty() const {
+	return this->size() == 0;
+}
+
+template<typename T>
+size_t KnotIndex<T>::size() const {
+	if ( _view != nullptr )
+		return _viewSize;
+	return _knots.size() - _first;
+}
+
+template<typename T>
+T KnotIndex<T>::operator[] (size_t i) const {
+#ifdef DEBUG_BUILD
+	if ( i >= this->size() ){
+		gslpp::error_handling::Error("Access to knot "+std::to_string(i)+" out of range",
+				gslpp::error_handling::Error::OUT_OF_BOUNDS);
+	}
+#endif
+	return this->data()[i];
+}
+
+template<typename T>
+T const * KnotIndex<T>::data() const {
+	if ( _view != nullptr )
+		return _view;
+	return _knots.data() + _first;
+}
+
+template<typename T>
+typename KnotIndex<T>::MeshType KnotIndex<T>::mesh_type() const {
+	return _meshType;
+}
+
+template<typename T>
+T KnotIndex<T>::origin() const {
+	return _origin;
+}
+
+template<typename T>
+T KnotIndex<T>::inverse_spacing() const {
+	return _inverseSpacing;
+}
+
+template<typename T>
+size_t KnotIndex<T>::find_interval(T x) const {
+#ifdef DEBUG_BUILD
+	if ( this->size() < 2 ){
+		gslpp::error_handling::Error("Search for an interval with less than two knots",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+	}
+#endif
+	if ( _meshType == general )
+		return this->find_interval_by_search(x,0,this->size()-1);
+	return this->find_interval_by_spacing(x);
+}
+
+template<typename T>
+size_t KnotIndex<T>::find_interval(T x, KnotCursor & cursor) const {
+#ifdef DEBUG_BUILD
+	if ( this->size() < 2 ){
+		gslpp::error_handling::Error("Search for an interval with less than two knots",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+	}
+#endif
+	if ( _meshType == general )
+		cursor.interval = this->find_interval_by_hunt(x,cursor.interval);
+	else
+		cursor.interval = this->find_interval_by_spacing(x);
+	return cursor.interval;
+}
+
+template<typename T>
+size_t KnotIndex<T>::find_interval_by_hunt(T x, size_t start) const {
+	const size_t lastInterval = this->size() - 2;
+	size_t lower = std::min(start,lastInterval);
+	size_t upper = lower + 1;
+	if ( x < this->data()[lower] ) {
+		//step down until the knot lower is not larger than x or the first knot is reached
+		size_t step = 1;
+		upper = lower;
+		while ( true ) {
+			if ( step >= upper ) {
+				lower = 0;
+				break;
+			}
+			lower = upper - step;
+			if ( this->data()[lower] <= x )
+				break;
+			upper = lower;
+			step *= 2;
+		}
+	} else {
+		//step up until the knot upper is larger than x or the last knot is reached
+		size_t step = 1;
+		while ( true ) {
+			upper = lower + step;
+			if ( upper > lastInterval ) {
+				upper = lastInterval + 1;
+				break;
+			}
+			if ( x < this->data()[upper] )
+				break;
+			lower = upper;
+			step *= 2;
+		}
+	}
+	return this->find_interval_by_search(x,lower,upper);
+}
+
+template<typename T>
+void KnotIndex<T>::detect_mesh_type() {
+	_meshType = general;
+	if ( this->size() < 3 )
+		return;
+	if ( this->is_uniform(false) ) {
+		_meshType = uniform;
+		_origin = this->data()[0];
+		_inverseSpacing = T(this->size()-1)/(this->data()[this->size()-1]-this->data()[0]);
+	} else if ( (this->data()[0] > 0) and this->is_uniform(true) ) {
+		_meshType = logUniform;
+		_origin = std::log(this->data()[0]);
+		_inverseSpacing = T(this->size()-1)/(std::log(this->data()[this->size()-1])-_origin);
+	}
+}
+
+template<typename T>
+bool KnotIndex<T>::is_uniform(bool logarithmic) const {
+	const T front = (logarithmic ? std::log(this->data()[0]) : this->data()[0]);
+	const T back = (logarithmic ? std::log(this->data()[this->size()-1]) : this->data()[this->size()-1]);
+	const T h = (back-front)/T(this->size()-1);
+	for ( size_t i = 1 ; i+1 < this->size() ; ++i){
+		const T xi = (logarithmic ? std::log(this->data()[i]) : this->data()[i]);
+		if ( std::fabs(xi - (front + h*T(i))) > h*T(_uniformTolerance) )
+			return false;
+	}
+	return true;
+}
+
+template<typename T>
+size_t KnotIndex<T>::find_interval_by_spacing(T x) const {
+	const size_t lastInterval = this->size() - 2;
+	const T u = (_meshType == uniform ? x : ( x > 0 ? std::log(x) : _origin ) );
+	const T estimate = (u - _origin)*_inverseSpacing;
+	//the negated comparison also maps NaN to the first interval
+	size_t i = 0;
+	if ( not (estimate < T(0)) )
+		i = ( estimate < T(lastInterval) ? static_cast<size_t>(estimate) : lastInterval );
+	//the knots deviate from the uniform spacing by less than h/2, so the estimate is at most one interval off.
+	//	This correction makes the result agree with the search exactly.
+	if ( (i > 0) and (x < this->data()[i]) )
+		--i;
+	else if ( (i < lastInterval) and (this->data()[i+1] <= x) )
+		++i;
+	return i;
+}
+
+template<typename T>
+size_t KnotIndex<T>::find_interval_by_search(T x, size_t begin, size_t end) const {
+	//the last knot with base[0] <= x among the lower knots of the intervals is in [base,base+length).
+	//	For the full range the last knot is excluded, which maps points at or above it to the last interval.
+	T const * base = this->data() + begin;
+	size_t length = end - begin;
+	while ( length > 1 ) {
+		const size_t half = length / 2;
+		base = ( base[half] <= x ) ? base + half : base;
+		length -= half;
+	}
+	return static_cast<size_t>(base - this->data());
+}
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
@@ -0,0 +1,130 @@
+/*
+ * MappedBiCubicInterpolation.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/data_interpolation/MappedBiCubicInterpolation.h"
+#include "gslpp/error_handling/Error.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+template<typename T>
+MappedBiCubicInterpolation<T>::MappedBiCubicInterpolation() {
+	this->clear();
+}
+
+template<typename T>
+MappedBiCubicInterpolation<T>::MappedBiCubicInterpolation(std::string const& fileName) {
+	this->initialize(fileName);
+}
+
+template<typename T>
+void MappedBiCubicInterpolation<T>::initialize(std::string const& fileName) {
+	this->clear();
+	TableFile<T> file(fileName);
+	if ( file.dimensions() != 2 )
+		gslpp::error_handling::Error("The table file "+fileName+" does not contain a bicubic interpolation",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	_file = file;
+
+	_gridValuesX.assign_view(_file.knots(0),_file.num_knots(0),
+			_file.mesh_type(0),_file.origin(0),_file.inverse_spacing(0));
+	_gridValuesY.assign_view(_file.knots(1),_file.num_knots(1),
+			_file.mesh_type(1),_file.origin(1),_file.inverse_spacing(1));
+	_coefficients = _file.coefficients();
+	_numPolynomsY = _file.num_knots(1)-1;
+	_isInit = true;
+}
+
+template<typename T>
+void MappedBiCubicInterpolation<T>::clear() {
+	_gridValuesX.clear();
+	_gridValuesY.clear();
+	_file = TableFile<T>();
+	_coefficients = nullptr;
+	_numPolynomsY = 0;
+	_isInit = false;
+}
+
+template<typename T>
+T const * MappedBiCubicInterpolation<T>::find_cell(T x, T y, T &deltaX, T &deltaY) const {
+#ifdef DEBUG_BUILD
+	if ( not _isInit )
+		gslpp::error_handling::Error("Mapped bicubic interpolation is not init while trying to evaluate",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+	if ( (x < this->min_range_x()) or (x > this->max_range_x())
+			or (y < this->min_range_y()) or (y > this->max_range_y()) )
+		gslpp::error_handling::Error( "Cannot find a cell in range for a point that is out of range!" ,
+				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+#endif
+	const size_t indexX = _gridValuesX.find_interval(x);
+	const size_t indexY = _gridValuesY.find_interval(y);
+	deltaX = x - _gridValuesX.data()[indexX];
+	deltaY = y - _gridValuesY.data()[indexY];
+	return _coefficients + 16*(indexX*_numPolynomsY+indexY);
+}
+
+template<typename T>
+T MappedBiCubicInterpolation<T>::operator() (T x, T y) const {
+	T result;
+	this->evaluate(x,y,result);
+	return result;
+}
+
+template<typename T>
+void MappedBiCubicInterpolation<T>::evaluate(T x, T y,T &dataInterpolation) const {
+	T deltaX, deltaY;
+	T const * a = this->find_cell(x,y,deltaX,deltaY);
+	//the coefficient a[i*4+j] belongs to deltaY^i deltaX^j
+	T rows[4];
+	for ( size_t i = 0 ; i < 4; ++i)
+		rows[i] = a[i*4] + deltaX*(a[i*4+1] + deltaX*(a[i*4+2] + deltaX*a[i*4+3]));
+	dataInterpolation = rows[0] + deltaY*(rows[1] + deltaY*(rows[2] + deltaY*rows[3]));
+}
+
+template<typename T>
+void MappedBiCubicInterpolation<T>::evaluate_derivative(T x, T y,T &gradX, T &gradY) const {
+	T deltaX, deltaY;
+	T const * a = this->find_cell(x,y,deltaX,deltaY);
+	T rows[4], rowDerivatives[4];
+	for ( size_t i = 0 ; i < 4; ++i) {
+		rows[i] = a[i*4] + deltaX*(a[i*4+1] + deltaX*(a[i*4+2] + deltaX*a[i*4+3]));
+		rowDerivatives[i] = a[i*4+1] + deltaX*(2*a[i*4+2] + deltaX*3*a[i*4+3]);
+	}
+	gradX = rowDerivatives[0] + deltaY*(rowDerivatives[1] + deltaY*(rowDerivatives[2] + deltaY*rowDerivatives[3]));
+	gradY = rows[1] + deltaY*(2*rows[2] + deltaY*3*rows[3]);
+}
+
+template<typename T>
+void MappedBiCubicInterpolation<T>::data_range(T &xMin, T &xMax, T &yMin, T &yMax) const {
+	xMin = this->min_range_x();
+	xMax = this->max_range_x();
+	yMin = this->min_range_y();
+	yMax = this->max_range_y();
+}
+
+template<typename T>
+T MappedBiCubicInterpolation<T>::min_range_x() const {
+	return _gridValuesX[0];
+}
+
+template<typename T>
+T MappedBiCubicInterpolation<T>::min_range_y() const {
+	return _gridValuesY[0];
+}
+
+template<typename T>
+T MappedBiCubicInterpolation<T>::max_range_x() const {
+	return _gridValuesX[_gridValuesX.size()-1];
+}
+
+template<typename T>
+T MappedBiCubicInterpolation<T>::max_range_y() const {
+	return _gridValuesY[_gridValuesY.size()-1];
+}
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
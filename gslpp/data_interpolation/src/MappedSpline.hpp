@@ -0,0 +1,116 @@
+/*
+ * MappedSpline.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/data_interpolation/MappedSpline.h"
+#include "gslpp/error_handling/Error.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+template<typename T>
+MappedSpline<T>::MappedSpline() {
+	this->clear();
+}
+
+template<typename T>
+MappedSpline<T>::MappedSpline(std::string const& fileName) {
+	this->initialize(fileName);
+}
+
+template<typename T>
+void MappedSpline<T>::initialize(std::string const& fileName) {
+	this->clear();
+	TableFile<T> file(fileName);
+	if ( file.dimensions() != 1 )
+		gslpp::error_handling::Error("The table file "+fileName+" does not contain a spline",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	_file = file;
+
+	const size_t numKnots = _file.num_knots(0);
+	_knots.assign_view(_file.knots(0),numKnots,_file.mesh_type(0),_file.origin(0),_file.inverse_spacing(0));
+	_coefficients = _file.coefficients();
+	this->set_range_of_definition(_knots[0],_knots[numKnots-1]);
+	this->set_init_state(true);
+}
+
+template<typename T>
+void MappedSpline<T>::clear() {
+	_knots.clear();
+	_file = TableFile<T>();
+	_coefficients = nullptr;
+	this->set_init_state(false);
+}
+
+template<typename T>
+size_t MappedSpline<T>::num_segments() const {
+	return _knots.size() > 0 ? _knots.size()-1 : 0;
+}
+
+template<typename T>
+size_t MappedSpline<T>::find_segment(T x) const {
+#ifdef DEBUG_BUILD
+	if ( _coefficients == nullptr )
+		gslpp::error_handling::Error("Mapped spline is not init while trying to evaluate",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+	if ( not this->x_is_in_range(x) )
+		gslpp::error_handling::Error( "Cannot find a segment in range for x that is out of range!" ,
+				gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+#endif
+	return _knots.find_interval(x);
+}
+
+template<typename T>
+void MappedSpline<T>::evaluate(T x, T &value) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	T const * c = _coefficients + 4*i;
+	value = c[0] + delta*(c[1] + delta*(c[2] + delta*c[3]));
+}
+
+template<typename T>
+void MappedSpline<T>::evaluate(T x, T &value, T &derivative) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	T const * c = _coefficients + 4*i;
+	value = c[0] + delta*(c[1] + delta*(c[2] + delta*c[3]));
+	derivative = c[1] + delta*(2*c[2] + delta*3*c[3]);
+}
+
+template<typename T>
+void MappedSpline<T>::evaluate(T x, T &value, T &derivative, T &second_derivative) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	T const * c = _coefficients + 4*i;
+	value = c[0] + delta*(c[1] + delta*(c[2] + delta*c[3]));
+	derivative = c[1] + delta*(2*c[2] + delta*3*c[3]);
+	second_derivative = 2*c[2] + delta*6*c[3];
+}
+
+template<typename T>
+void MappedSpline<T>::evaluate_derivative(T x, T &derivative) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	T const * c = _coefficients + 4*i;
+	derivative = c[1] + delta*(2*c[2] + delta*3*c[3]);
+}
+
+template<typename T>
+void MappedSpline<T>::evaluate_second_derivative(T x, T &second_derivative) const {
+	const size_t i = this->find_segment(x);
+	const T delta = x - _knots.data()[i];
+	T const * c = _coefficients + 4*i;
+	second_derivative = 2*c[2] + delta*6*c[3];
+}
+
+template<typename T>
+void MappedSpline<T>::evaluate(T const * xs, T * values, size_t n) const {
+	for ( size_t k = 0 ; k < n; ++k)
+		this->evaluate(xs[k],values[k]);
+}
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
@@ -6,19 +6,38 @@
  */
 
 #include "gslpp/data_interpolation/MonotoneCubeHermiteSpline.h"
+#include "gslpp/error_handling/Error.h"
+#include "gslpp/auxillary/ParallelRanges.h"
+#include <algorithm>
+#include <string>
+#include <cmath>
+#include <thread>
+#include <limits>
 
 namespace gslpp {
 namespace data_interpolation {
 
 template<typename T,class Polynom>
-MonotoneCubeHermiteSpline<T,Polynom>::MonotoneCubeHermiteSpline(){
+MonotoneCubeHermiteSpline<T,Polynom>::MonotoneCubeHermiteSpline() : _numThreads(0) {
 }
 
 template<typename T,class Polynom>
 MonotoneCubeHermiteSpline<T,Polynom>::MonotoneCubeHermiteSpline(
 		std::vector<T> const& strictlyIncreasingGridX,
 		std::vector<T> const& functionValuesForXGrid)
-		: BaseSpline<MonotoneCubeHermiteSpline<T,Polynom>,T,Polynom>(strictlyIncreasingGridX,functionValuesForXGrid){
+		: BaseSpline<MonotoneCubeHermiteSpline<T,Polynom>,T,Polynom>(), _numThreads(0) {
+	//initialize here and not in the base, since the members have to be constructed first
+	this->initialize(strictlyIncreasingGridX,functionValuesForXGrid);
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::clear() {
+	BaseSpline<MonotoneCubeHermiteSpline<T,Polynom>,T,Polynom>::clear();
+	_mesh.clear();
+	_data.clear();
+	_derivatives.clear();
+	_enteringDerivatives.clear();
+	_enteringBetas.clear();
 }
 
 template<typename T,class Polynom>
@@ -32,72 +51,398 @@ void MonotoneCubeHermiteSpline<T,Polynom>::initialize(std::vector<T> const& mesh
 	this->clear();
 
 	this->insert_grid(mesh);
+	this->resize_polynomials(Polynom(mesh[0],mesh[1],data[0],data[1],T(0),T(0)));
 
-	std::vector<T> derivatives;
-	std::vector<T> secants;
-	this->compute_derivatives_no_adjusting( mesh, data , derivatives , secants );
+	const size_t numSteps = mesh.size()-1;
+	const size_t numChunks = gslpp::auxillary::num_threads_for_items(this->get_num_threads(),numSteps);
+	std::vector<AdjustmentState> chunkEnd(numChunks);
+	gslpp::auxillary::for_each_range_in_parallel(0,numSteps,numChunks,
+			[&] (size_t c, size_t first, size_t last) {
+				this->initialize_range(mesh,data,first,last,chunkEnd[c]);
+			});
 
-	ensure_monotonicity_in_derivatives(derivatives,secants);
+	//correct the chunks in order, starting from the true state that the previous one leaves
+	AdjustmentState state = chunkEnd[0];
+	for ( size_t c = 1 ; c < numChunks ; ++c )
+		this->correct_range(mesh,data,gslpp::auxillary::range_begin(0,numSteps,numChunks,c),
+				gslpp::auxillary::range_begin(0,numSteps,numChunks,c+1),chunkEnd[c],state);
+
+	this->set_init_state(true);
+}
 
-	for ( size_t i = 0 ; i < mesh.size()-1 ; ++i ){
-		Polynom polynom( mesh[i],mesh[i+1],data[i], data[i+1],
-				derivatives[i], derivatives[i+1]);
-		this->insert_polynom(polynom);
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::initialize_range(std::vector<T> const& mesh, std::vector<T> const& data,
+		size_t first, size_t last, AdjustmentState & stateAtEnd) {
+	const size_t numPoints = mesh.size();
+	T derivative, enteringBeta;
+	if ( first == 0 ) {
+		derivative = (data[1]-data[0])/(mesh[1]-mesh[0]);
+		enteringBeta = 0;
+	} else {
+		guess_entering_state(mesh,data,first,derivative,enteringBeta);
 	}
 
-	this->set_init_state(true);
+	//the secant of interval i is computed once and enters the derivative without adjusting at i+1 as well
+	T secant = (data[first+1]-data[first])/(mesh[first+1]-mesh[first]);
+	T previousDerivative = 0;
+	for ( size_t i = first ; i < last ; ++i ) {
+		T nextDerivative = secant;
+		T nextSecant = 0;
+		if ( i+2 < numPoints ) {
+			nextSecant = (data[i+2]-data[i+1])/(mesh[i+2]-mesh[i+1]);
+			nextDerivative = (secant + nextSecant)/2.0;
+		}
+		T nextEnteringBeta;
+		adjustment_step(secant,enteringBeta,derivative,nextDerivative,nextEnteringBeta);
+		//the polynomial before the chunk depends on the correction of the guess
+		if ( i > first )
+			this->replace_polynom(i-1,Polynom(mesh[i-1],mesh[i],data[i-1],data[i],previousDerivative,derivative));
+		previousDerivative = derivative;
+		derivative = nextDerivative;
+		enteringBeta = nextEnteringBeta;
+		secant = nextSecant;
+	}
+	stateAtEnd.previousDerivative = previousDerivative;
+	stateAtEnd.enteringDerivative = derivative;
+	stateAtEnd.enteringBeta = enteringBeta;
+
+	//the last polynomial of the chunk takes the adjusted derivative at its end from the state at the end.
+	//	It is replaced in the correction of the next chunk if this state is not the true one.
+	if ( last+1 < numPoints ) {
+		T nextDerivative, nextEnteringBeta;
+		adjustment_step(mesh,data,last,enteringBeta,derivative,nextDerivative,nextEnteringBeta);
+	}
+	this->replace_polynom(last-1,Polynom(mesh[last-1],mesh[last],data[last-1],data[last],previousDerivative,derivative));
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::correct_range(std::vector<T> const& mesh, std::vector<T> const& data,
+		size_t first, size_t last, AdjustmentState const& guessedStateAtEnd, AdjustmentState & state) {
+	//repeat the steps from the true entering state together with the steps from the guess, until they
+	//	arrive at the same state. From there on the polynomials of the chunk are correct.
+	T guessedDerivative, guessedBeta;
+	guess_entering_state(mesh,data,first,guessedDerivative,guessedBeta);
+	size_t i = first;
+	for ( ; i < last ; ++i ) {
+		if ( (state.enteringDerivative == guessedDerivative) and (state.enteringBeta == guessedBeta) )
+			break;
+		T derivative = state.enteringDerivative;
+		T nextDerivative, nextEnteringBeta;
+		adjustment_step(mesh,data,i,state.enteringBeta,derivative,nextDerivative,nextEnteringBeta);
+		T guessedNextDerivative, guessedNextBeta;
+		adjustment_step(mesh,data,i,guessedBeta,guessedDerivative,guessedNextDerivative,guessedNextBeta);
+		this->replace_polynom(i-1,Polynom(mesh[i-1],mesh[i],data[i-1],data[i],state.previousDerivative,derivative));
+		state.previousDerivative = derivative;
+		state.enteringDerivative = nextDerivative;
+		state.enteringBeta = nextEnteringBeta;
+		guessedDerivative = guessedNextDerivative;
+		guessedBeta = guessedNextBeta;
+	}
+
+	if ( i == last ) {
+		//the next chunk sets the last polynomial, unless this is the end of the mesh
+		if ( last+1 == mesh.size() )
+			this->replace_polynom(last-1,Polynom(mesh[last-1],mesh[last],data[last-1],data[last],
+					state.previousDerivative,state.enteringDerivative));
+		return;
+	}
+
+	//only the polynomial before the point where the states agree has a different derivative at its lower end
+	T derivative = state.enteringDerivative;
+	T nextDerivative, nextEnteringBeta;
+	adjustment_step(mesh,data,i,state.enteringBeta,derivative,nextDerivative,nextEnteringBeta);
+	this->replace_polynom(i-1,Polynom(mesh[i-1],mesh[i],data[i-1],data[i],state.previousDerivative,derivative));
+	state = guessedStateAtEnd;
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::guess_entering_state(std::vector<T> const& mesh, std::vector<T> const& data,
+		size_t i, T & enteringDerivative, T & enteringBeta) {
+	//the state that step i-1 leaves unless it rescales the derivatives or its interval is flat
+	const T previousSecant = (data[i]-data[i-1])/(mesh[i]-mesh[i-1]);
+	enteringDerivative = enteringBeta = 0;
+	if ( std::fabs(previousSecant) >= 1e-8 ) {
+		enteringDerivative = (previousSecant + (data[i+1]-data[i])/(mesh[i+1]-mesh[i]))/2.0;
+		enteringBeta = enteringDerivative/previousSecant;
+	}
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::adjustment_step(std::vector<T> const& mesh, std::vector<T> const& data,
+		size_t i, T enteringBeta, T & derivative, T & nextDerivative, T & nextEnteringBeta) {
+	const T secant = (data[i+1]-data[i])/(mesh[i+1]-mesh[i]);
+	nextDerivative = secant;
+	if ( i+2 < mesh.size() )
+		nextDerivative = (secant + (data[i+2]-data[i+1])/(mesh[i+2]-mesh[i+1]))/2.0;
+	adjustment_step(secant,enteringBeta,derivative,nextDerivative,nextEnteringBeta);
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::make_modifiable() {
+	if ( not _mesh.empty() )
+		return;
+	//the mesh, the data and the derivatives are exact in the polynomials, the entering states of the
+	//	adjustment follow from one pass
+	const size_t numPolynomials = this->num_polynomials();
+	_mesh.resize(numPolynomials+1);
+	_data.resize(numPolynomials+1);
+	_derivatives.resize(numPolynomials+1);
+	_enteringDerivatives.resize(numPolynomials+1);
+	_enteringBetas.resize(numPolynomials+1);
+	for ( size_t i = 0 ; i < numPolynomials ; ++i ) {
+		_mesh[i] = this->get_polynomial(i).min_range();
+		_data[i] = this->get_polynomial(i).value_at_range_min();
+	}
+	_mesh[numPolynomials] = this->get_polynomial(numPolynomials-1).max_range();
+	_data[numPolynomials] = this->get_polynomial(numPolynomials-1).value_at_range_max();
+	this->adjust_derivatives(0,numPolynomials+1);
+}
+
+template<typename T,class Polynom>
+T MonotoneCubeHermiteSpline<T,Polynom>::value_at_point(size_t i) const {
+	const size_t numPolynomials = this->num_polynomials();
+	return ( i < numPolynomials ? this->get_polynomial(i).value_at_range_min()
+			: this->get_polynomial(numPolynomials-1).value_at_range_max() );
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::set_num_threads(size_t numThreads) {
+	_numThreads = numThreads;
+}
+
+template<typename T,class Polynom>
+size_t MonotoneCubeHermiteSpline<T,Polynom>::get_num_threads() const {
+	if ( _numThreads > 0 )
+		return _numThreads;
+	return std::max(1u,std::thread::hardware_concurrency());
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::append(T x, T y) {
+	if ( this->num_polynomials() == 0 )
+		gslpp::error_handling::Error( "Appending a point to a spline with less than 2 points" ,
+				gslpp::error_handling::Error::INPUT_ERROR);
+	this->make_modifiable();
+	_mesh.push_back(x);
+	_data.push_back(y);
+	_derivatives.push_back(T(0));
+	_enteringDerivatives.push_back(T(0));
+	_enteringBetas.push_back(T(0));
+	this->append_grid_point(x);
+
+	//the derivative without adjusting changes at the previous last point, which enters the step before
+	const size_t lastPoint = _mesh.size()-1;
+	const size_t firstStep = ( lastPoint >= 2 ? lastPoint-2 : 0 );
+	this->adjust_derivatives(firstStep,lastPoint);
+	this->set_polynomials(( firstStep > 0 ? firstStep-1 : 0 ),lastPoint-1);
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::pop_front() {
+	if ( this->num_polynomials() < 2 )
+		gslpp::error_handling::Error( "Removing a point from a spline with less than 3 points" ,
+				gslpp::error_handling::Error::INPUT_ERROR);
+	this->make_modifiable();
+	_mesh.pop_front();
+	_data.pop_front();
+	_derivatives.pop_front();
+	_enteringDerivatives.pop_front();
+	_enteringBetas.pop_front();
+	this->remove_first_grid_point();
+
+	const size_t end = this->adjust_derivatives(0,0);
+	this->set_polynomials(0,std::min(end-1,_mesh.size()-2));
 }
 
 template<typename T,class Polynom>
-void MonotoneCubeHermiteSpline<T,Polynom>::compute_derivatives_no_adjusting(
-		std::vector<T> const& mesh,std::vector<T> const& data,
-		std::vector<T> &derivatives, std::vector<T> &secants) const {
+void MonotoneCubeHermiteSpline<T,Polynom>::update(size_t i, T y) {
+	if ( (this->num_polynomials() == 0) or (i > this->num_polynomials()) )
+		gslpp::error_handling::Error( "Update of the point "+std::to_string(i)+" that is not in the spline" ,
+				gslpp::error_handling::Error::OUT_OF_BOUNDS);
+	this->make_modifiable();
+	_data[i] = y;
 
-	derivatives.clear();
-	derivatives.reserve(mesh.size());
-	secants.clear();
-	secants.reserve(mesh.size()-1);
+	//the derivatives without adjusting change at i-1, i and i+1, where the one at i-1 enters the step i-2
+	const size_t firstStep = ( i >= 2 ? i-2 : 0 );
+	const size_t end = this->adjust_derivatives(firstStep,std::min(i+1,_mesh.size()-1));
+	this->set_polynomials(( firstStep > 0 ? firstStep-1 : 0 ),std::min(end-1,_mesh.size()-2));
+}
 
-	//compute secants for each interval
-	T interval;
-	for ( size_t i = 0 ; i < mesh.size() - 1 ; ++i){
-		interval = mesh[i+1]-mesh[i];
-		secants.push_back( (data[i+1]-data[i])/interval );
+template<typename T,class Polynom>
+T MonotoneCubeHermiteSpline<T,Polynom>::evaluate_inverse(T y) const {
+	T x;
+	this->evaluate_inverse(&y,&x,1);
+	return x;
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::evaluate_inverse(T const * ys, T * xs, size_t n) const {
+#ifdef DEBUG_BUILD
+	if ( not this->is_init() ){
+		gslpp::error_handling::Error("Spline is not init while trying to evaluate the inverse",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
 	}
+#endif
+	for ( size_t blockStart = 0 ; blockStart < n ; blockStart += _inverseBlockSize )
+		this->evaluate_inverse_block(ys+blockStart,xs+blockStart,std::min(n-blockStart,size_t(_inverseBlockSize)));
+}
 
-	//compute derivatives for each point as the average of the two secants of the adjacent intervals
-	//	the first and the last one are set to the secants of that interval
-	derivatives.push_back( secants.front() );
-	for ( size_t i = 1 ; i < secants.size() ; ++i)
-		derivatives.push_back( (secants[i-1] + secants[i])/2.0 );
-	derivatives.push_back( secants.back() );
-}
-
-template<typename T,class Polynom>
-void MonotoneCubeHermiteSpline<T,Polynom>::ensure_monotonicity_in_derivatives(
-		std::vector<T> &derivatives, std::vector<T> const &secants) const {
-	T lastBeta = 0;
-	for ( size_t i = 0 ; i < secants.size() ; ++i){
-		if ( std::fabs(secants[i]) < 1e-8 ){
-			derivatives[i] = derivatives[i+1] = 0;
-		} else {
-			T alpha = derivatives[i]/secants[i];
-			T beta = derivatives[i+1]/secants[i];
-			//
-			//
-			if ( (alpha*alpha + beta*beta) > 9 ) {
-				derivatives[i] = 3 *  secants[i] * alpha / std::sqrt(  alpha*alpha + beta*beta );
-				derivatives[i+1] = 3 *  secants[i] * beta / std::sqrt(  alpha*alpha + beta*beta );
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::evaluate_inverse_block(T const * ys, T * xs, size_t n) const {
+	const size_t numPoints = this->num_polynomials()+1;
+	const bool increasing = not ( this->value_at_point(numPoints-1) < this->value_at_point(0) );
+
+	//the polynomials in the power basis of t in [0,1] minus the value, the bracket of the root and the current t
+	T c0[_inverseBlockSize], c1[_inverseBlockSize], c2[_inverseBlockSize], c3[_inverseBlockSize];
+	T lower[_inverseBlockSize], upper[_inverseBlockSize], t[_inverseBlockSize];
+	T origins[_inverseBlockSize], lengths[_inverseBlockSize];
+	bool converged[_inverseBlockSize];
+	for ( size_t k = 0 ; k < n ; ++k ) {
+		//the first point with a value that is not before y in the direction of the data
+		size_t j = 0;
+		for ( size_t count = numPoints ; count > 0 ; ) {
+			const size_t step = count/2;
+			const T value = this->value_at_point(j+step);
+			if ( increasing ? (value < ys[k]) : (ys[k] < value) ) {
+				j += step+1;
+				count -= step+1;
+			} else {
+				count = step;
 			}
-			//
-			if ( ((alpha < 0) or (lastBeta < 0)) )
-				derivatives[i] = 0;
-			//
-			lastBeta = beta;
 		}
+		const size_t i = std::min(std::max(j,size_t(1)),numPoints-1)-1;
+		converged[k] = false;
+		Polynom const& p = this->get_polynomial(i);
+		origins[k] = p.min_range();
+		lengths[k] = p.interval_length();
+		if ( (j == 0) or (j == numPoints) ) {
+			//a value outside of the data gives the end of the mesh with a fixed t
+			c0[k] = c1[k] = c2[k] = c3[k] = 0;
+			t[k] = lower[k] = upper[k] = ( j == 0 ? T(0) : T(1) );
+			continue;
+		}
+#ifdef DEBUG_BUILD
+		if ( (p.value_at_range_min()-ys[k])*(p.value_at_range_max()-ys[k]) > 0 ) {
+			gslpp::error_handling::Error("The data of the spline is not monotone while trying to evaluate the inverse",
+					gslpp::error_handling::Error::INPUT_ERROR);
+		}
+#endif
+		T c[4];
+		p.power_basis_coefficients(c);
+		c0[k] = c[0] - ys[k];
+		c1[k] = c[1];
+		c2[k] = c[2];
+		c3[k] = c[3];
+		lower[k] = 0;
+		upper[k] = 1;
+		//start from the linear interpolation
+		t[k] = (ys[k]-p.value_at_range_min())/(p.value_at_range_max()-p.value_at_range_min());
+	}
+
+	//the steps for the values of the block are done together until all are converged. A Newton step that leaves
+	//	the bracket of the root is replaced by a bisection. A converged value is not changed by the further steps.
+	const T direction = ( increasing ? T(1) : T(-1) );
+	const T tolerance = 4*std::numeric_limits<T>::epsilon();
+	for ( int step = 0 ; step < std::numeric_limits<T>::digits ; ++step ) {
+		bool allConverged = true;
+		for ( size_t k = 0 ; k < n ; ++k ) {
+			const T g = c0[k] + t[k]*(c1[k] + t[k]*(c2[k] + t[k]*c3[k]));
+			const T dg = c1[k] + t[k]*(2*c2[k] + t[k]*3*c3[k]);
+			const bool rootAbove = ( direction*g < 0 );
+			lower[k] = ( rootAbove ? t[k] : lower[k] );
+			upper[k] = ( rootAbove ? upper[k] : t[k] );
+			const T bisection = T(0.5)*(lower[k]+upper[k]);
+			T next = ( g == 0 ? t[k] : ( dg != 0 ? t[k] - g/dg : bisection ) );
+			next = ( (next >= lower[k]) and (next <= upper[k]) ? next : bisection );
+			next = ( converged[k] ? t[k] : next );
+			converged[k] = converged[k] or ( std::fabs(next-t[k]) <= tolerance );
+			allConverged = allConverged and converged[k];
+			t[k] = next;
+		}
+		if ( allConverged )
+			break;
 	}
+
+	for ( size_t k = 0 ; k < n ; ++k )
+		xs[k] = origins[k] + t[k]*lengths[k];
+}
+
+template<typename T,class Polynom>
+T MonotoneCubeHermiteSpline<T,Polynom>::secant(size_t i) const {
+	T interval = _mesh[i+1]-_mesh[i];
+	return (_data[i+1]-_data[i])/interval;
 }
 
+template<typename T,class Polynom>
+T MonotoneCubeHermiteSpline<T,Polynom>::derivative_no_adjusting(size_t i) const {
+	if ( i == 0 )
+		return this->secant(0);
+	if ( i+1 == _mesh.size() )
+		return this->secant(i-1);
+	return (this->secant(i-1) + this->secant(i))/2.0;
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::adjustment_step(T secant, T enteringBeta,
+		T & derivative, T & nextDerivative, T & nextEnteringBeta) {
+	nextEnteringBeta = enteringBeta;
+	if ( std::fabs(secant) < 1e-8 ){
+		derivative = nextDerivative = 0;
+	} else {
+		T alpha = derivative/secant;
+		T beta = nextDerivative/secant;
+		//
+		//
+		if ( (alpha*alpha + beta*beta) > 9 ) {
+			derivative = 3 *  secant * alpha / std::sqrt(  alpha*alpha + beta*beta );
+			nextDerivative = 3 *  secant * beta / std::sqrt(  alpha*alpha + beta*beta );
+		}
+		//
+		if ( ((alpha < 0) or (enteringBeta < 0)) )
+			derivative = 0;
+		//
+		nextEnteringBeta = beta;
+	}
+}
+
+template<typename T,class Polynom>
+size_t MonotoneCubeHermiteSpline<T,Polynom>::adjust_derivatives(size_t firstStep, size_t lastChanged) {
+	const size_t numPoints = _mesh.size();
+	if ( firstStep == 0 ) {
+		_enteringDerivatives[0] = this->derivative_no_adjusting(0);
+		_enteringBetas[0] = 0;
+	}
+	for ( size_t i = firstStep ; i+1 < numPoints ; ++i){
+		T derivative = _enteringDerivatives[i];
+		T nextEnteringDerivative = this->derivative_no_adjusting(i+1);
+		T nextEnteringBeta;
+		adjustment_step(this->secant(i),_enteringBetas[i],derivative,nextEnteringDerivative,nextEnteringBeta);
+		_derivatives[i] = derivative;
+		//behind the last changed point the steps only depend on the entering state. If it is as before,
+		//	the remaining adjustment is as well.
+		const bool asBefore = ( i+1 >= lastChanged ) and ( i+2 < numPoints )
+				and ( nextEnteringDerivative == _enteringDerivatives[i+1] )
+				and ( nextEnteringBeta == _enteringBetas[i+1] );
+		_enteringDerivatives[i+1] = nextEnteringDerivative;
+		_enteringBetas[i+1] = nextEnteringBeta;
+		if ( asBefore )
+			return i+1;
+	}
+	_derivatives[numPoints-1] = _enteringDerivatives[numPoints-1];
+	return numPoints;
+}
+
+template<typename T,class Polynom>
+void MonotoneCubeHermiteSpline<T,Polynom>::set_polynomials(size_t first, size_t last) {
+	for ( size_t i = first ; i <= last ; ++i ){
+		Polynom polynom( _mesh[i],_mesh[i+1],_data[i], _data[i+1],
+				_derivatives[i], _derivatives[i+1]);
+		if ( i < this->num_polynomials() )
+			this->replace_polynom(i,polynom);
+		else
+			this->insert_polynom(polynom);
+	}
+}
 
 } /* namespace data_interpolation */
 } /* namespace gslpp */
@@ -0,0 +1,196 @@
+/*
+ * MultiSpline.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/data_interpolation/MultiSpline.h"
+#include "gslpp/error_handling/Error.h"
+
+namespace gslpp {
+namespace data_interpolation {
+
+template<typename T>
+MultiSpline<T>::MultiSpline() {
+	this->clear();
+}
+
+template<typename T>
+MultiSpline<T>::MultiSpline(std::vector<T> const& mesh, std::vector<T> const& data, size_t numColumns) {
+	this->initialize(mesh,data,numColumns);
+}
+
+template<typename T>
+void MultiSpline<T>::initialize(std::vector<T> const& mesh, std::vector<T> const& data, size_t numColumns) {
+	this->clear();
+	std::vector<T> derivatives;
+	solve_for_derivatives(mesh,data,numColumns,derivatives);
+	_knots.assign(mesh);
+	_numColumns = numColumns;
+
+	//the Hermite form of the interval in the power basis of Delta = x - x_i with the secant s
+	//	c_0 = y_i, c_1 = k_i, c_2 = (3s - 2k_i - k_{i+1})/h, c_3 = (k_i + k_{i+1} - 2s)/h^2
+	const size_t numIntervals = mesh.size()-1;
+	_coefficients.resize(numIntervals*4*numColumns);
+	for ( size_t i = 0 ; i < numIntervals; ++i) {
+		const T invH = T(1)/(mesh[i+1]-mesh[i]);
+		T const * y = &data[i*numColumns];
+		T const * k = &derivatives[i*numColumns];
+		T * c = &_coefficients[i*4*numColumns];
+		for ( size_t j = 0 ; j < numColumns; ++j) {
+			const T secant = (y[numColumns+j]-y[j])*invH;
+			c[j] = y[j];
+			c[numColumns+j] = k[j];
+			c[2*numColumns+j] = (T(3)*secant - T(2)*k[j] - k[numColumns+j])*invH;
+			c[3*numColumns+j] = (k[j] + k[numColumns+j] - T(2)*secant)*invH*invH;
+		}
+	}
+}
+
+template<typename T>
+void MultiSpline<T>::solve_for_derivatives(std::vector<T> const& mesh, std::vector<T> const& data,
+		size_t numColumns, std::vector<T> & derivatives,
+		T const * firstDerivatives, T const * lastDerivatives) {
+	if ( (mesh.size() < 2) or (numColumns == 0) or (mesh.size()*numColumns != data.size()) )
+		gslpp::error_handling::Error( "Input data for spline generation is rubbish" ,
+				gslpp::error_handling::Error::INPUT_ERROR);
+
+	//The continuity of the second derivative at the interior points and a vanishing second derivative
+	//	at the borders gives the tridiagonal system for the derivatives k_i
+	//		k_{i-1}/h_{i-1} + 2(1/h_{i-1}+1/h_i) k_i + k_{i+1}/h_i
+	//			= 3( (y_i-y_{i-1})/h_{i-1}^2 + (y_{i+1}-y_i)/h_i^2 )
+	//	with h_i = x_{i+1}-x_i and one right hand side per column. It is strictly diagonally dominant and
+	//	is solved without pivoting by the Thomas algorithm. The elimination of the matrix is done once,
+	//	storing the modified upper diagonal in upperModified. The right hand sides are eliminated row by row
+	//	for all columns at once and stored in derivatives. A fixed derivative at a border replaces the row by k_i = value.
+	const size_t dim = mesh.size();
+	const size_t m = numColumns;
+	std::vector<T> upperModified(dim);
+	derivatives.resize(dim*m);
+
+	T invH = T(1)/(mesh[1]-mesh[0]);
+	if ( firstDerivatives != nullptr ) {
+		upperModified[0] = T(0);
+		for ( size_t j = 0 ; j < m; ++j)
+			derivatives[j] = firstDerivatives[j];
+	} else {
+		const T diagonal = T(2)*invH;
+		upperModified[0] = invH/diagonal;
+		for ( size_t j = 0 ; j < m; ++j)
+			derivatives[j] = T(3)*(data[m+j]-data[j])*invH*invH/diagonal;
+	}
+	for (size_t i=1;i<dim;i++){
+		T * rhs = &derivatives[i*m];
+		if ( (i+1 == dim) and (lastDerivatives != nullptr) ) {
+			upperModified[i] = T(0);
+			for ( size_t j = 0 ; j < m; ++j)
+				rhs[j] = lastDerivatives[j];
+			break;
+		}
+		const T invHLower = invH;
+		T diagonal = T(2)*invHLower;
+		T upper = T(0);
+		if ( i+1 < dim ) {
+			invH = T(1)/(mesh[i+1]-mesh[i]);
+			diagonal += T(2)*invH;
+			upper = invH;
+		}
+		const T pivot = diagonal - invHLower*upperModified[i-1];
+		upperModified[i] = upper/pivot;
+
+		T const * yLower = &data[(i-1)*m];
+		T const * y = &data[i*m];
+		T const * rhsLower = &derivatives[(i-1)*m];
+		if ( i+1 < dim ) {
+			T const * yUpper = &data[(i+1)*m];
+			for ( size_t j = 0 ; j < m; ++j) {
+				const T rowRhs = T(3)*(y[j]-yLower[j])*invHLower*invHLower + T(3)*(yUpper[j]-y[j])*invH*invH;
+				rhs[j] = (rowRhs - invHLower*rhsLower[j])/pivot;
+			}
+		} else {
+			for ( size_t j = 0 ; j < m; ++j) {
+				const T rowRhs = T(3)*(y[j]-yLower[j])*invHLower*invHLower;
+				rhs[j] = (rowRhs - invHLower*rhsLower[j])/pivot;
+			}
+		}
+	}
+
+	//back substitution
+	for (size_t i=dim-1;i-- > 0;) {
+		T * k = &derivatives[i*m];
+		T const * kUpper = &derivatives[(i+1)*m];
+		for ( size_t j = 0 ; j < m; ++j)
+			k[j] -= upperModified[i]*kUpper[j];
+	}
+}
+
+template<typename T>
+void MultiSpline<T>::clear() {
+	_knots.clear();
+	_numColumns = 0;
+	_coefficients.clear();
+}
+
+template<typename T>
+size_t MultiSpline<T>::num_columns() const {
+	return _numColumns;
+}
+
+template<typename T>
+T MultiSpline<T>::min_range() const {
+	return _knots[0];
+}
+
+template<typename T>
+T MultiSpline<T>::max_range() const {
+	return _knots[_knots.size()-1];
+}
+
+template<typename T>
+size_t MultiSpline<T>::find_interval(T x) const {
+#ifdef DEBUG_BUILD
+	if ( _knots.size() < 2 )
+		gslpp::error_handling::Error("Multi spline is not init while trying to evaluate",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+	if ( (x < this->min_range()) or (x > this->max_range()) )
+		gslpp::error_handling::Error("evaluation outside the range of definition",
+				gslpp::error_handling::Error::OUT_OF_BOUNDS);
+#endif
+	return _knots.find_interval(x);
+}
+
+template<typename T>
+void MultiSpline<T>::evaluate(T x, T * values) const {
+	const size_t i = this->find_interval(x);
+	const T delta = x - _knots.data()[i];
+	const size_t m = _numColumns;
+	T const * c = &_coefficients[i*4*m];
+	for ( size_t j = 0 ; j < m; ++j)
+		values[j] = c[j] + delta*(c[m+j] + delta*(c[2*m+j] + delta*c[3*m+j]));
+}
+
+template<typename T>
+void MultiSpline<T>::evaluate(T x, T * values, T * derivatives) const {
+	const size_t i = this->find_interval(x);
+	const T delta = x - _knots.data()[i];
+	const size_t m = _numColumns;
+	T const * c = &_coefficients[i*4*m];
+	for ( size_t j = 0 ; j < m; ++j) {
+		values[j] = c[j] + delta*(c[m+j] + delta*(c[2*m+j] + delta*c[3*m+j]));
+		derivatives[j] = c[m+j] + delta*(T(2)*c[2*m+j] + delta*T(3)*c[3*m+j]);
+	}
+}
+
+template<typename T>
+void MultiSpline<T>::evaluate_derivative(T x, T * derivatives) const {
+	const size_t i = this->find_interval(x);
+	const T delta = x - _knots.data()[i];
+	const size_t m = _numColumns;
+	T const * c = &_coefficients[i*4*m];
+	for ( size_t j = 0 ; j < m; ++j)
+		derivatives[j] = c[m+j] + delta*(T(2)*c[2*m+j] + delta*T(3)*c[3*m+j]);
+}
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
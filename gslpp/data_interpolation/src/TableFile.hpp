@@ -0,0 +1,262 @@
+/*
+ * TableFile.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/data_interpolation/TableFile.h"
+#include "gslpp/error_handling/Error.h"
+#include <cstring>
+#include <vector>
+
+namespace gslpp {
+namespace data_interpolation {
+
+namespace detail {
+//the byte order mark as read on a machine with the opposite byte order
+constexpr uint32_t tableFileByteOrderMark = 0x01020304;
+constexpr uint32_t tableFileSwappedByteOrderMark = 0x04030201;
+} /* namespace detail */
+
+template<typename T>
+TableFile<T>::TableFile() : _coefficientsOffset(0) {
+	std::memset(&_header,0,sizeof(Header));
+	_knotsOffset[0] = _knotsOffset[1] = 0;
+}
+
+template<typename T>
+TableFile<T>::TableFile(std::string const& fileName) : _coefficientsOffset(0) {
+	std::memset(&_header,0,sizeof(Header));
+	{
+		std::ifstream file(fileName.c_str(),std::ios::binary);
+		if ( not file.good() )
+			gslpp::error_handling::Error("Unable to open the table file "+fileName+" for reading",
+					gslpp::error_handling::Error::FILE_IO_ERR);
+		file.read(reinterpret_cast<char *>(&_header),sizeof(Header));
+		if ( not file.good() )
+			gslpp::error_handling::Error("The file "+fileName+" is too short for the header of a table file",
+					gslpp::error_handling::Error::INPUT_ERROR);
+	}
+	if ( std::strncmp(_header.magic,"GSLPPTAB",8) != 0 )
+		gslpp::error_handling::Error("The file "+fileName+" is not a table file",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	if ( _header.byteOrderMark == detail::tableFileSwappedByteOrderMark )
+		gslpp::error_handling::Error("The table file "+fileName+" was written on a machine with a different byte order",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	if ( _header.byteOrderMark != detail::tableFileByteOrderMark )
+		gslpp::error_handling::Error("The table file "+fileName+" has an invalid byte order mark",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	if ( _header.version != version )
+		gslpp::error_handling::Error("The table file "+fileName+" has the version "+std::to_string(_header.version)
+				+" instead of "+std::to_string(version),gslpp::error_handling::Error::INPUT_ERROR);
+	if ( _header.valueSize != sizeof(T) )
+		gslpp::error_handling::Error("The table file "+fileName+" has numbers of "+std::to_string(_header.valueSize)
+				+" bytes instead of "+std::to_string(sizeof(T)),gslpp::error_handling::Error::INPUT_ERROR);
+	if ( (_header.dimensions < 1) or (_header.dimensions > 2) )
+		gslpp::error_handling::Error("The table file "+fileName+" has "+std::to_string(_header.dimensions)
+				+" dimensions",gslpp::error_handling::Error::INPUT_ERROR);
+
+	size_t offset = 0;
+	size_t numSegments = 1;
+	for ( size_t d = 0 ; d < 2; ++d) {
+		_knotsOffset[d] = offset;
+		if ( d >= _header.dimensions )
+			continue;
+		if ( _header.numKnots[d] < 2 )
+			gslpp::error_handling::Error("The table file "+fileName+" has less than 2 knots in a dimension",
+					gslpp::error_handling::Error::INPUT_ERROR);
+		if ( _header.meshType[d] > uint32_t(KnotIndex<T>::logUniform) )
+			gslpp::error_handling::Error("The table file "+fileName+" has an invalid spacing of the knots",
+					gslpp::error_handling::Error::INPUT_ERROR);
+		offset += padded_size(_header.numKnots[d]);
+		numSegments *= _header.numKnots[d]-1;
+	}
+	_coefficientsOffset = offset;
+	const size_t numCoefficients = numSegments*( _header.dimensions == 1 ? 4 : 16 );
+
+	_mapping = std::make_shared<gslpp::auxillary::MappedArray<T> >(fileName,sizeof(Header));
+	if ( _mapping->size() < _coefficientsOffset + numCoefficients )
+		gslpp::error_handling::Error("The table file "+fileName+" is shorter than stated in its header",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	_mapping->advise_random_access();
+}
+
+template<typename T>
+template<class spline>
+void TableFile<T>::write(std::string const& fileName, spline const& source) {
+	const size_t numSegments = source.num_polynomials();
+	if ( numSegments == 0 )
+		gslpp::error_handling::Error("Cannot write a spline without polynomials",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+
+	std::vector<T> knots;
+	for ( size_t i = 0 ; i < numSegments; ++i)
+		knots.push_back(source.get_polynomial(i).min_range());
+	knots.push_back(source.get_polynomial(numSegments-1).max_range());
+	KnotIndex<T> knotIndex;
+	knotIndex.assign(knots);
+
+	std::ofstream file(fileName.c_str(),std::ios::binary | std::ios::trunc);
+	write_header(file,fileName,&knotIndex,1);
+	write_knots(file,knotIndex);
+
+	for ( size_t i = 0 ; i < numSegments; ++i) {
+		T coefficients[4];
+		CompactSpline<T>::segment_coefficients(source.get_polynomial(i),coefficients);
+		file.write(reinterpret_cast<char const *>(coefficients),4*sizeof(T));
+	}
+	check_written(file,fileName);
+}
+
+template<typename T>
+void TableFile<T>::write(std::string const& fileName, BiCubicInterpolation<T> const& source) {
+	const size_t numPolynomsX = source.num_polynomials_x();
+	const size_t numPolynomsY = source.num_polynomials_y();
+	if ( (numPolynomsX == 0) or (numPolynomsY == 0) )
+		gslpp::error_handling::Error("Cannot write an interpolation without polynomials",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+
+	KnotIndex<T> knotIndices[2];
+	std::vector<T> knots;
+	for ( size_t ix = 0 ; ix < numPolynomsX; ++ix)
+		knots.push_back(source.get_polynomial(ix,0).min_range_x());
+	knots.push_back(source.max_range_x());
+	knotIndices[0].assign(knots);
+
+	knots.clear();
+	for ( size_t iy = 0 ; iy < numPolynomsY; ++iy)
+		knots.push_back(source.get_polynomial(0,iy).min_range_y());
+	knots.push_back(source.max_range_y());
+	knotIndices[1].assign(knots);
+
+	std::ofstream file(fileName.c_str(),std::ios::binary | std::ios::trunc);
+	write_header(file,fileName,knotIndices,2);
+	write_knots(file,knotIndices[0]);
+	write_knots(file,knotIndices[1]);
+
+	for ( size_t ix = 0 ; ix < numPolynomsX; ++ix) {
+		for ( size_t iy = 0 ; iy < numPolynomsY; ++iy) {
+			T coefficients[16];
+			source.get_polynomial(ix,iy).power_basis_coefficients(coefficients);
+			file.write(reinterpret_cast<char const *>(coefficients),16*sizeof(T));
+		}
+	}
+	check_written(file,fileName);
+}
+
+template<typename T>
+size_t TableFile<T>::dimensions() const {
+	return _header.dimensions;
+}
+
+template<typename T>
+size_t TableFile<T>::num_knots(size_t dimension) const {
+#ifdef DEBUG_BUILD
+	if ( dimension >= _header.dimensions )
+		gslpp::error_handling::Error("Access to the knots of dimension "+std::to_string(dimension)
+				+" that is not in the table",gslpp::error_handling::Error::OUT_OF_BOUNDS);
+#endif
+	return _header.numKnots[dimension];
+}
+
+template<typename T>
+T const * TableFile<T>::knots(size_t dimension) const {
+#ifdef DEBUG_BUILD
+	if ( (not _mapping) or (dimension >= _header.dimensions) )
+		gslpp::error_handling::Error("Access to the knots of dimension "+std::to_string(dimension)
+				+" that is not in the table",gslpp::error_handling::Error::OUT_OF_BOUNDS);
+#endif
+	return _mapping->data() + _knotsOffset[dimension];
+}
+
+template<typename T>
+typename KnotIndex<T>::MeshType TableFile<T>::mesh_type(size_t dimension) const {
+#ifdef DEBUG_BUILD
+	if ( dimension >= _header.dimensions )
+		gslpp::error_handling::Error("Access to the knots of dimension "+std::to_string(dimension)
+				+" that is not in the table",gslpp::error_handling::Error::OUT_OF_BOUNDS);
+#endif
+	return static_cast<typename KnotIndex<T>::MeshType>(_header.meshType[dimension]);
+}
+
+template<typename T>
+T TableFile<T>::origin(size_t dimension) const {
+#ifdef DEBUG_BUILD
+	if ( dimension >= _header.dimensions )
+		gslpp::error_handling::Error("Access to the knots of dimension "+std::to_string(dimension)
+				+" that is not in the table",gslpp::error_handling::Error::OUT_OF_BOUNDS);
+#endif
+	return static_cast<T>(_header.origin[dimension]);
+}
+
+template<typename T>
+T TableFile<T>::inverse_spacing(size_t dimension) const {
+#ifdef DEBUG_BUILD
+	if ( dimension >= _header.dimensions )
+		gslpp::error_handling::Error("Access to the knots of dimension "+std::to_string(dimension)
+				+" that is not in the table",gslpp::error_handling::Error::OUT_OF_BOUNDS);
+#endif
+	return static_cast<T>(_header.inverseSpacing[dimension]);
+}
+
+template<typename T>
+T const * TableFile<T>::coefficients() const {
+#ifdef DEBUG_BUILD
+	if ( not _mapping )
+		gslpp::error_handling::Error("Access to the coefficients without a table file",
+				gslpp::error_handling::Error::ACCESS_WITHOUT_INIT);
+#endif
+	return _mapping->data() + _coefficientsOffset;
+}
+
+template<typename T>
+size_t TableFile<T>::padded_size(size_t numValues) {
+	const size_t valuesPerLine = 64/sizeof(T);
+	return ((numValues + valuesPerLine - 1)/valuesPerLine)*valuesPerLine;
+}
+
+template<typename T>
+void TableFile<T>::write_header(std::ofstream & file, std::string const& fileName,
+		KnotIndex<T> const * knots, size_t dimensions) {
+	if ( not file.good() )
+		gslpp::error_handling::Error("Unable to open the table file "+fileName+" for writing",
+				gslpp::error_handling::Error::FILE_IO_ERR);
+	Header header;
+	std::memset(&header,0,sizeof(Header));
+	std::memcpy(header.magic,"GSLPPTAB",8);
+	header.version = version;
+	header.byteOrderMark = detail::tableFileByteOrderMark;
+	header.valueSize = sizeof(T);
+	header.dimensions = static_cast<uint32_t>(dimensions);
+	for ( size_t d = 0 ; d < dimensions; ++d) {
+		header.numKnots[d] = knots[d].size();
+		header.meshType[d] = static_cast<uint32_t>(knots[d].mesh_type());
+		header.origin[d] = knots[d].origin();
+		header.inverseSpacing[d] = knots[d].inverse_spacing();
+	}
+	file.write(reinterpret_cast<char const *>(&header),sizeof(Header));
+}
+
+template<typename T>
+void TableFile<T>::write_knots(std::ofstream & file, KnotIndex<T> const& knots) {
+	file.write(reinterpret_cast<char const *>(knots.data()),knots.size()*sizeof(T));
+	write_padding(file,knots.size());
+}
+
+template<typename T>
+void TableFile<T>::write_padding(std::ofstream & file, size_t numValues) {
+	const T zero = 0;
+	for ( size_t i = numValues ; i < padded_size(numValues); ++i)
+		file.write(reinterpret_cast<char const *>(&zero),sizeof(T));
+}
+
+template<typename T>
+void TableFile<T>::check_written(std::ofstream const& file, std::string const& fileName) {
+	if ( not file.good() )
+		gslpp::error_handling::Error("Unable to write the table file "+fileName,
+				gslpp::error_handling::Error::FILE_IO_ERR);
+}
+
+} /* namespace data_interpolation */
+} /* namespace gslpp */
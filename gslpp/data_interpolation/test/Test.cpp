@@ -23,6 +23,34 @@ void RunTest::run_test(){
 
 	test_CubeSpline<double>();
 	test_CubeSpline<float>();
+	test_CubeSpline_large_mesh<double>();
+
+	test_KnotIndex<double>();
+	test_KnotIndex<float>();
+
+	test_cursor_evaluation<double>();
+	test_cursor_evaluation<float>();
+
+	test_batch_evaluation<double>();
+	test_batch_evaluation<float>();
+
+	test_CompactSpline<double>();
+	test_CompactSpline<float>();
+
+	test_TableFile<double>();
+	test_TableFile<float>();
+
+	test_spline_modification<double>();
+	test_spline_modification<float>();
+
+	test_parallel_initialization<double>();
+	test_parallel_initialization<float>();
+
+	test_inverse_evaluation<double>();
+	test_inverse_evaluation<float>();
+
+	test_MultiSpline<double>();
+	test_MultiSpline<float>();
 
 	test_HermitePolynomial<double>();
 	test_HermitePolynomial<float>();
@@ -26,6 +26,36 @@ private:
 	template<typename T>
 	void test_CubeSpline();
 
+	template<typename T>
+	void test_CubeSpline_large_mesh();
+
+	template<typename T>
+	void test_KnotIndex();
+
+	template<typename T>
+	void test_cursor_evaluation();
+
+	template<typename T>
+	void test_batch_evaluation();
+
+	template<typename T>
+	void test_CompactSpline();
+
+	template<typename T>
+	void test_TableFile();
+
+	template<typename T>
+	void test_spline_modification();
+
+	template<typename T>
+	void test_parallel_initialization();
+
+	template<typename T>
+	void test_inverse_evaluation();
+
+	template<typename T>
+	void test_MultiSpline();
+
 	template<typename T>
 	void test_HermitePolynomial();
 
@@ -35,6 +65,11 @@ private:
 	template<typename T>
 	void test_CubeSpline2D();
 
+	//compare all evaluations of the spline with a cursor to the ones without at the positions xs.
+	//	Returns the index of the first position that differs or xs.size().
+	template<class spline, typename T>
+	size_t compare_cursor_evaluation(spline const& s, std::vector<T> const& xs) const;
+
 	template<typename T>
 	void get_polynomial_test_data(std::vector<T> & xValues,
 			std::vector<T> & polynomialData,
@@ -10,6 +10,19 @@
 #include "gslpp/data_interpolation/HermitePolynomial.h"
 #include "gslpp/data_interpolation/MonotoneCubeHermiteSpline.h"
 #include "gslpp/data_interpolation/BiCubicInterpolation.h"
+#include "gslpp/data_interpolation/src/KnotIndex.h"
+#include "gslpp/data_interpolation/CompactSpline.h"
+#include "gslpp/data_interpolation/MultiSpline.h"
+#include "gslpp/data_interpolation/TableFile.h"
+#include "gslpp/data_interpolation/MappedSpline.h"
+#include "gslpp/data_interpolation/MappedBiCubicInterpolation.h"
+#include <cstdio>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <thread>
 
 namespace gslpp{
 namespace data_interpolation{
@@ -59,6 +72,723 @@ void RunTest::test_CubeSpline() {
 	}
 }
 
+template<typename T>
+void RunTest::test_CubeSpline_large_mesh() {
+
+	//a non-uniform mesh over five periods of the sine, such that the vanishing second derivative
+	//	at the borders is exact. The second derivative must be continuous at all interior points.
+	const size_t numPoints = 5001;
+	const T h = T(10.0*M_PI)/T(numPoints-1);
+	std::vector<T> xValues(numPoints);
+	std::vector<T> dataSet(numPoints);
+	for ( size_t i = 0 ; i < numPoints; ++i){
+		xValues[i] = h*i + ( (i == 0) or (i+1 == numPoints) ? T(0) : T(0.3)*h*std::sin(T(i)) );
+		dataSet[i] = std::sin(xValues[i]);
+	}
+	gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > cubeSpline;
+	cubeSpline.initialize(xValues,dataSet);
+
+	T maxJump = 0, maxValueError = 0, maxDerivativeError = 0;
+	std::vector<T> derivatives = cubeSpline.deriviatives_at_underlying_grid_points();
+	for ( size_t i = 0 ; i+1 < numPoints; ++i){
+		T left, right, value;
+		if ( i > 0 ) {
+			cubeSpline.get_polynomial(i-1).evaluate_second_derivative(xValues[i],left);
+			cubeSpline.get_polynomial(i).evaluate_second_derivative(xValues[i],right);
+			maxJump = std::max(maxJump,std::fabs(left-right));
+		}
+		const T xMid = (xValues[i]+xValues[i+1])*T(0.5);
+		cubeSpline.evaluate(xMid,value);
+		maxValueError = std::max(maxValueError,std::fabs(value-std::sin(xMid)));
+		maxDerivativeError = std::max(maxDerivativeError,std::fabs(derivatives[i]-std::cos(xValues[i])));
+	}
+	if ( (maxJump > 1e-5) or (maxValueError > 1e-10) or (maxDerivativeError > 1e-7) ) {
+		_allSuccess = false;
+		std::cout << "Test of "<< nameOfTypeTrait<T>() << " cubic spline on a large mesh failed:\n"
+				<< "\tjump of the second derivative " << maxJump << ", error of the values " << maxValueError
+				<< ", error of the derivatives " << maxDerivativeError << "\n";
+	}
+}
+
+template<typename T>
+void RunTest::test_KnotIndex() {
+
+	//compare the interval of the knots, points next to the knots, the midpoints and points outside of the mesh with
+	//	the result of std::upper_bound for all numbers of knots up to a few powers of two, with and without a cursor.
+	//	This is done for a perturbed, a uniform and a log-uniform mesh, where the latter two must be detected.
+	const typename KnotIndex<T>::MeshType meshTypes[] = {KnotIndex<T>::general,
+			KnotIndex<T>::uniform, KnotIndex<T>::logUniform};
+	for ( auto meshType : meshTypes ) {
+		for ( size_t numKnots = 2 ; numKnots < 70; ++numKnots) {
+			std::vector<T> knots(numKnots);
+			for ( size_t i = 0 ; i < numKnots; ++i) {
+				if ( meshType == KnotIndex<T>::general )
+					knots[i] = T(i) + T(0.25)*std::sin(T(i));
+				else if ( meshType == KnotIndex<T>::uniform )
+					knots[i] = T(-3.3) + T(0.1)*T(i);
+				else
+					knots[i] = T(1e-3)*std::pow(T(10),T(i)/T(7));
+			}
+			KnotIndex<T> knotIndex;
+			knotIndex.assign(knots);
+			if ( (numKnots > 2) and (knotIndex.mesh_type() != meshType) ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " knot index failed: mesh type "
+						<< knotIndex.mesh_type() << " instead of " << meshType << " for " << numKnots << " knots\n";
+				return;
+			}
+
+			std::vector<T> points(1,knots.front()-T(1));
+			for ( size_t i = 0 ; i < numKnots; ++i) {
+				points.push_back(knots[i]);
+				points.push_back(std::nextafter(knots[i],knots.front()-T(1)));
+				points.push_back(std::nextafter(knots[i],knots.back()+T(1)));
+				if ( i+1 < numKnots )
+					points.push_back((knots[i]+knots[i+1])*T(0.5));
+			}
+			points.push_back(knots.back()+T(1));
+			//the cursor is used for points in increasing order, in decreasing order and jumping back and forth
+			std::vector<T> pointsForCursor(points);
+			pointsForCursor.insert(pointsForCursor.end(),points.rbegin(),points.rend());
+			for ( size_t k = 0 ; k < points.size(); ++k)
+				pointsForCursor.push_back(points[(k*37) % points.size()]);
+			KnotCursor cursor;
+			for ( size_t k = 0 ; k < pointsForCursor.size(); ++k) {
+				const T x = pointsForCursor[k];
+				size_t reference = std::upper_bound(knots.begin(),knots.end(),x) - knots.begin();
+				reference = std::min(std::max(reference,size_t(1)),numKnots-1) - 1;
+				const size_t startOfCursor = cursor.interval;
+				const size_t withCursor = knotIndex.find_interval(x,cursor);
+				if ( ( (k < points.size()) and (knotIndex.find_interval(x) != reference) )
+						or (withCursor != reference) or (cursor.interval != reference) ) {
+					_allSuccess = false;
+					std::cout << "Test of "<< nameOfTypeTrait<T>() << " knot index failed for "
+							<< numKnots << " knots of mesh type " << meshType << " at x=" << x << ": interval "
+							<< knotIndex.find_interval(x) << " and " << withCursor << " from the cursor at "
+							<< startOfCursor << " instead of " << reference << "\n";
+					return;
+				}
+			}
+		}
+	}
+}
+
+template<typename T>
+void RunTest::test_cursor_evaluation() {
+
+	//positions forward, backward and jumping on a non uniform mesh, such that the cursor hunts in all directions
+	const size_t numPoints = 40;
+	std::vector<T> xValues(numPoints), dataSet(numPoints);
+	for ( size_t i = 0 ; i < numPoints; ++i){
+		xValues[i] = T(i) + T(0.4)*std::sin(T(i));
+		dataSet[i] = std::sin(T(0.3)*xValues[i]) + T(0.01)*xValues[i]*xValues[i];
+	}
+	std::vector<T> xs;
+	for ( size_t k = 0 ; k < 300; ++k)
+		xs.push_back(xValues.front() + (xValues.back()-xValues.front())*T(k)/T(300));
+	for ( size_t k = 0 ; k < 300; ++k)
+		xs.push_back(xs[299-k]);
+	for ( size_t k = 0 ; k < 300; ++k)
+		xs.push_back(xs[(k*97) % 300]);
+
+	//the spline with a cursor must give the same results as without
+	gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > cubeSpline;
+	cubeSpline.initialize(xValues,dataSet);
+	MonotoneCubeHermiteSpline<T> hermiteSpline(xValues,dataSet);
+	for ( int spline = 0 ; spline < 2; ++spline ) {
+		const size_t k = ( spline == 0 ? this->compare_cursor_evaluation(cubeSpline,xs)
+				: this->compare_cursor_evaluation(hermiteSpline,xs) );
+		if ( k != xs.size() ) {
+			_allSuccess = false;
+			std::cout << "Test of "<< nameOfTypeTrait<T>() << " evaluation of the "
+					<< (spline == 0 ? "cubic" : "monotone Hermite") << " spline with a cursor failed at x="
+					<< xs[k] << "\n";
+			return;
+		}
+	}
+	std::vector<T> referenceValues(xs.size());
+	for ( size_t k = 0 ; k < xs.size(); ++k)
+		cubeSpline.evaluate(xs[k],referenceValues[k]);
+
+	//the same for the bicubic interpolation along a path through the grid
+	std::vector<T> gridData;
+	for ( size_t i = 0 ; i < numPoints; ++i)
+		for ( size_t j = 0 ; j < numPoints; ++j)
+			gridData.push_back(dataSet[i]*dataSet[j]);
+	BiCubicInterpolation<T> interpolation(xValues,xValues,gridData);
+	//with -ffast-math the same formula may be rounded differently where it is inlined
+	auto differ = [] (T a, T b, T scale) {
+		return std::fabs(a-b) > T(64)*std::numeric_limits<T>::epsilon()*(1+std::fabs(scale));
+	};
+	typename BiCubicInterpolation<T>::Cursor cursor2D;
+	for ( size_t k = 0 ; k < xs.size(); ++k) {
+		const T y = xs[(k*13) % xs.size()];
+		T value, gradX, gradY, cursorValue, cursorGradX, cursorGradY;
+		interpolation.evaluate(xs[k],y,value);
+		interpolation.evaluate_derivative(xs[k],y,gradX,gradY);
+		interpolation.evaluate(xs[k],y,cursorValue,cursor2D);
+		interpolation.evaluate_derivative(xs[k],y,cursorGradX,cursorGradY,cursor2D);
+		if ( differ(cursorValue,value,value) or differ(cursorGradX,gradX,value) or differ(cursorGradY,gradY,value) ) {
+			_allSuccess = false;
+			std::cout << "Test of "<< nameOfTypeTrait<T>() << " evaluation of the bicubic interpolation"
+					" with a cursor failed at x=" << xs[k] << ", y=" << y << ": value "
+					<< cursorValue << " instead of " << value << "\n";
+			return;
+		}
+	}
+
+	//several threads evaluate the same objects, each with its own cursor and starting point
+	const size_t numThreads = 4;
+	std::vector<std::vector<T> > splineValues(numThreads,std::vector<T>(xs.size()));
+	std::vector<std::vector<T> > bicubicValues(numThreads,std::vector<T>(xs.size()));
+	std::vector<std::thread> threads;
+	for ( size_t t = 0 ; t < numThreads; ++t) {
+		threads.push_back(std::thread([&,t] () {
+			typename CubeSpline<T,CubicPolynomial<T> >::Cursor cursor;
+			typename BiCubicInterpolation<T>::Cursor threadCursor2D;
+			for ( size_t l = 0 ; l < xs.size(); ++l) {
+				const size_t k = (l + t*xs.size()/numThreads) % xs.size();
+				cubeSpline.evaluate(xs[k],splineValues[t][k],cursor);
+				if ( t % 2 == 0 )
+					interpolation.evaluate(xs[k],xs[(k*13) % xs.size()],bicubicValues[t][k],threadCursor2D);
+				else
+					interpolation.evaluate(xs[k],xs[(k*13) % xs.size()],bicubicValues[t][k]);
+			}
+		}));
+	}
+	for ( size_t t = 0 ; t < numThreads; ++t)
+		threads[t].join();
+	for ( size_t t = 0 ; t < numThreads; ++t) {
+		for ( size_t k = 0 ; k < xs.size(); ++k) {
+			const T bicubicValue = interpolation(xs[k],xs[(k*13) % xs.size()]);
+			if ( differ(splineValues[t][k],referenceValues[k],referenceValues[k])
+					or differ(bicubicValues[t][k],bicubicValue,bicubicValue) ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " concurrent evaluation failed in thread "
+						<< t << " at x=" << xs[k] << ": spline value " << splineValues[t][k]
+						<< " instead of " << referenceValues[k] << "\n";
+				return;
+			}
+		}
+	}
+}
+
+template<class spline, typename T>
+size_t RunTest::compare_cursor_evaluation(spline const& s, std::vector<T> const& xs) const {
+	//with -ffast-math the same formula may be rounded differently where it is inlined. The rounding errors
+	//	of the derivatives are on the scale of the values.
+	T value[2], derivative[2], secondDerivative[2];
+	auto differ = [&value] (T a, T b) {
+		return std::fabs(a-b) > T(64)*std::numeric_limits<T>::epsilon()*(1+std::fabs(value[0]));
+	};
+	typename spline::Cursor cursor;
+	for ( size_t k = 0 ; k < xs.size(); ++k) {
+		s.evaluate(xs[k],value[0]);
+		s.evaluate(xs[k],value[1],cursor);
+		if ( differ(value[0],value[1]) )
+			return k;
+		s.evaluate(xs[k],value[0],derivative[0]);
+		s.evaluate(xs[k],value[1],derivative[1],cursor);
+		if ( differ(value[0],value[1]) or differ(derivative[0],derivative[1]) )
+			return k;
+		s.evaluate(xs[k],value[0],derivative[0],secondDerivative[0]);
+		s.evaluate(xs[k],value[1],derivative[1],secondDerivative[1],cursor);
+		if ( differ(value[0],value[1]) or differ(derivative[0],derivative[1]) or differ(secondDerivative[0],secondDerivative[1]) )
+			return k;
+		s.evaluate_derivative(xs[k],derivative[0]);
+		s.evaluate_derivative(xs[k],derivative[1],cursor);
+		s.evaluate_second_derivative(xs[k],secondDerivative[0]);
+		s.evaluate_second_derivative(xs[k],secondDerivative[1],cursor);
+		if ( differ(derivative[0],derivative[1]) or differ(secondDerivative[0],secondDerivative[1]) )
+			return k;
+	}
+	return xs.size();
+}
+
+template<typename T>
+void RunTest::test_batch_evaluation() {
+
+	//the batched evaluation of sorted and of shuffled positions must agree with the evaluation point by point
+	const size_t numPoints = 50;
+	std::vector<T> xValues(numPoints);
+	std::vector<T> dataSet(numPoints);
+	for ( size_t i = 0 ; i < numPoints; ++i){
+		xValues[i] = T(2.0*M_PI)*T(i)/T(numPoints-1) + T(0.02)*std::sin(T(3*i));
+		dataSet[i] = std::sin(xValues[i]);
+	}
+	gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > cubeSpline;
+	cubeSpline.initialize(xValues,dataSet);
+	MonotoneCubeHermiteSpline<T> hermiteSpline(xValues,dataSet);
+
+	const size_t numEvaluations = 1000;
+	std::vector<T> xs(numEvaluations);
+	for ( size_t k = 0 ; k < numEvaluations; ++k)
+		xs[k] = xValues.front() + (xValues.back()-xValues.front())*T(k)/T(numEvaluations);
+	std::vector<T> xsShuffled(xs);
+	for ( size_t k = 0 ; k < numEvaluations; ++k)
+		std::swap(xsShuffled[k],xsShuffled[(k*7919) % numEvaluations]);
+
+	const T tolerance = T(1000)*std::numeric_limits<T>::epsilon();
+	std::vector<T> values(numEvaluations), derivatives(numEvaluations), secondDerivatives(numEvaluations);
+	for ( int shuffled = 0 ; shuffled < 2; ++shuffled ) {
+		std::vector<T> const& x = (shuffled == 0 ? xs : xsShuffled);
+		for ( int spline = 0 ; spline < 2; ++spline ) {
+			if ( spline == 0 )
+				cubeSpline.evaluate(x.data(),values.data(),derivatives.data(),secondDerivatives.data(),numEvaluations);
+			else
+				hermiteSpline.evaluate(x.data(),values.data(),derivatives.data(),secondDerivatives.data(),numEvaluations);
+			for ( size_t k = 0 ; k < numEvaluations; ++k) {
+				T value, derivative, secondDerivative;
+				if ( spline == 0 )
+					cubeSpline.evaluate(x[k],value,derivative,secondDerivative);
+				else
+					hermiteSpline.evaluate(x[k],value,derivative,secondDerivative);
+				if ( (std::fabs(value-values[k]) > tolerance)
+						or (std::fabs(derivative-derivatives[k]) > tolerance*(1+std::fabs(derivative)))
+						or (std::fabs(secondDerivative-secondDerivatives[k]) > tolerance*numPoints*(1+std::fabs(secondDerivative))) ) {
+					_allSuccess = false;
+					std::cout << "Test of "<< nameOfTypeTrait<T>() << " batched evaluation of the "
+							<< (spline == 0 ? "cubic" : "monotone Hermite") << " spline failed for "
+							<< (shuffled == 0 ? "sorted" : "shuffled") << " positions at x=" << x[k] << ":\n"
+							<< "\tvalue " << values[k] << " instead of " << value
+							<< ", derivative " << derivatives[k] << " instead of " << derivative
+							<< ", second derivative " << secondDerivatives[k] << " instead of " << secondDerivative << "\n";
+					return;
+				}
+			}
+		}
+	}
+}
+
+template<typename T>
+void RunTest::test_CompactSpline() {
+
+	//the compact copy of a cubic and a monotone Hermite spline must agree with the original
+	const size_t numPoints = 50;
+	std::vector<T> xValues(numPoints);
+	std::vector<T> dataSet(numPoints);
+	for ( size_t i = 0 ; i < numPoints; ++i){
+		xValues[i] = T(2.0*M_PI)*T(i)/T(numPoints-1) + T(0.02)*std::sin(T(3*i));
+		dataSet[i] = std::sin(xValues[i]);
+	}
+	gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > cubeSpline;
+	cubeSpline.initialize(xValues,dataSet);
+	MonotoneCubeHermiteSpline<T> hermiteSpline(xValues,dataSet);
+	CompactSpline<T> compactCubeSpline(cubeSpline);
+	CompactSpline<T> compactHermiteSpline(hermiteSpline);
+	if ( (compactCubeSpline.num_segments() != numPoints-1) or (compactCubeSpline.min_range() != xValues.front())
+			or (compactCubeSpline.max_range() != xValues.back()) ) {
+		_allSuccess = false;
+		std::cout << "Test of "<< nameOfTypeTrait<T>() << " compact spline failed: wrong mesh\n";
+		return;
+	}
+
+	const size_t numEvaluations = 1000;
+	std::vector<T> xs(numEvaluations), values(numEvaluations);
+	for ( size_t k = 0 ; k < numEvaluations; ++k)
+		xs[k] = xValues.front() + (xValues.back()-xValues.front())*T(k)/T(numEvaluations);
+	const T tolerance = T(1000)*std::numeric_limits<T>::epsilon();
+	for ( int spline = 0 ; spline < 2; ++spline ) {
+		CompactSpline<T> const& compactSpline = (spline == 0 ? compactCubeSpline : compactHermiteSpline);
+		compactSpline.evaluate(xs.data(),values.data(),numEvaluations);
+		for ( size_t k = 0 ; k < numEvaluations; ++k) {
+			T value, derivative, secondDerivative;
+			if ( spline == 0 )
+				cubeSpline.evaluate(xs[k],value,derivative,secondDerivative);
+			else
+				hermiteSpline.evaluate(xs[k],value,derivative,secondDerivative);
+			T compactValue, compactDerivative, compactSecondDerivative;
+			compactSpline.evaluate(xs[k],compactValue,compactDerivative,compactSecondDerivative);
+			if ( (std::fabs(value-compactValue) > tolerance) or (compactValue != values[k])
+					or (std::fabs(derivative-compactDerivative) > tolerance*(1+std::fabs(derivative)))
+					or (std::fabs(secondDerivative-compactSecondDerivative) > tolerance*numPoints*(1+std::fabs(secondDerivative))) ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " compact copy of the "
+						<< (spline == 0 ? "cubic" : "monotone Hermite") << " spline failed at x=" << xs[k] << ":\n"
+						<< "\tvalue " << compactValue << " instead of " << value
+						<< ", derivative " << compactDerivative << " instead of " << derivative
+						<< ", second derivative " << compactSecondDerivative << " instead of " << secondDerivative << "\n";
+				return;
+			}
+		}
+	}
+}
+
+template<typename T>
+void RunTest::test_TableFile() {
+
+	//write a cubic and a monotone Hermite spline to a table file, map it and compare to the original
+	const std::string fileName = "table_file_test.bin";
+	const size_t numPoints = 50;
+	std::vector<T> xValues(numPoints);
+	std::vector<T> dataSet(numPoints);
+	for ( size_t i = 0 ; i < numPoints; ++i){
+		xValues[i] = T(2.0*M_PI)*T(i)/T(numPoints-1) + T(0.02)*std::sin(T(3*i));
+		dataSet[i] = std::sin(xValues[i]);
+	}
+	gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > cubeSpline;
+	cubeSpline.initialize(xValues,dataSet);
+	MonotoneCubeHermiteSpline<T> hermiteSpline(xValues,dataSet);
+
+	const size_t numEvaluations = 1000;
+	std::vector<T> xs(numEvaluations), values(numEvaluations);
+	for ( size_t k = 0 ; k < numEvaluations; ++k)
+		xs[k] = xValues.front() + (xValues.back()-xValues.front())*T(k)/T(numEvaluations);
+	const T tolerance = T(1000)*std::numeric_limits<T>::epsilon();
+	for ( int spline = 0 ; spline < 2; ++spline ) {
+		if ( spline == 0 )
+			TableFile<T>::write(fileName,cubeSpline);
+		else
+			TableFile<T>::write(fileName,hermiteSpline);
+		MappedSpline<T> mappedSpline(fileName);
+		if ( (mappedSpline.num_segments() != numPoints-1) or (mappedSpline.min_range() != xValues.front())
+				or (mappedSpline.max_range() != xValues.back()) ) {
+			_allSuccess = false;
+			std::cout << "Test of "<< nameOfTypeTrait<T>() << " mapped spline failed: wrong mesh\n";
+			std::remove(fileName.c_str());
+			return;
+		}
+		mappedSpline.evaluate(xs.data(),values.data(),numEvaluations);
+		for ( size_t k = 0 ; k < numEvaluations; ++k) {
+			T value, derivative, secondDerivative;
+			if ( spline == 0 )
+				cubeSpline.evaluate(xs[k],value,derivative,secondDerivative);
+			else
+				hermiteSpline.evaluate(xs[k],value,derivative,secondDerivative);
+			T mappedValue, mappedDerivative, mappedSecondDerivative;
+			mappedSpline.evaluate(xs[k],mappedValue,mappedDerivative,mappedSecondDerivative);
+			if ( (std::fabs(value-mappedValue) > tolerance) or (mappedValue != values[k])
+					or (std::fabs(derivative-mappedDerivative) > tolerance*(1+std::fabs(derivative)))
+					or (std::fabs(secondDerivative-mappedSecondDerivative) > tolerance*numPoints*(1+std::fabs(secondDerivative))) ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " mapped "
+						<< (spline == 0 ? "cubic" : "monotone Hermite") << " spline failed at x=" << xs[k] << ":\n"
+						<< "\tvalue " << mappedValue << " instead of " << value
+						<< ", derivative " << mappedDerivative << " instead of " << derivative
+						<< ", second derivative " << mappedSecondDerivative << " instead of " << secondDerivative << "\n";
+				std::remove(fileName.c_str());
+				return;
+			}
+		}
+	}
+
+	//on a uniform and a log-uniform mesh the spacing is stored in the header and used by the mapped spline
+	const typename KnotIndex<T>::MeshType spacedMeshTypes[] = {KnotIndex<T>::uniform, KnotIndex<T>::logUniform};
+	for ( auto meshType : spacedMeshTypes ) {
+		std::vector<T> spacedXValues(numPoints);
+		std::vector<T> spacedDataSet(numPoints);
+		for ( size_t i = 0 ; i < numPoints; ++i){
+			spacedXValues[i] = ( meshType == KnotIndex<T>::uniform ? T(0.1)*T(i) : T(1e-2)*std::pow(T(10),T(i)/T(25)) );
+			spacedDataSet[i] = std::sin(T(5)*spacedXValues[i]);
+		}
+		gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > spacedSpline;
+		spacedSpline.initialize(spacedXValues,spacedDataSet);
+		TableFile<T>::write(fileName,spacedSpline);
+		if ( TableFile<T>(fileName).mesh_type(0) != meshType ) {
+			_allSuccess = false;
+			std::cout << "Test of "<< nameOfTypeTrait<T>() << " table file failed: spacing of the knots "
+					<< TableFile<T>(fileName).mesh_type(0) << " instead of " << meshType << "\n";
+			std::remove(fileName.c_str());
+			return;
+		}
+		MappedSpline<T> mappedSpline(fileName);
+		for ( size_t k = 0 ; k < numEvaluations; ++k) {
+			//the knots below the last one and points in between
+			const T x = ( k+1 < numPoints ? spacedXValues[k] : spacedXValues.front()
+					+ (spacedXValues.back()-spacedXValues.front())*T(k+1-numPoints)/T(numEvaluations+1-numPoints) );
+			const T value = spacedSpline(x);
+			const T mappedValue = mappedSpline(x);
+			if ( std::fabs(value-mappedValue) > tolerance*(1+std::fabs(value)) ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " mapped spline on a "
+						<< (meshType == KnotIndex<T>::uniform ? "uniform" : "log-uniform") << " mesh failed at x="
+						<< x << ": value " << mappedValue << " instead of " << value << "\n";
+				std::remove(fileName.c_str());
+				return;
+			}
+		}
+	}
+
+	//the same for a bicubic interpolation on a non uniform grid
+	std::vector<T> xGrid, yGrid, gridData;
+	for ( size_t i = 0 ; i < 12; ++i)
+		xGrid.push_back(T(0.25)*T(i) + T(0.05)*std::sin(T(2*i)));
+	for ( size_t j = 0 ; j < 9; ++j)
+		yGrid.push_back(T(-1) + T(0.25)*T(j) + T(0.03)*std::cos(T(3*j)));
+	for ( size_t i = 0 ; i < xGrid.size(); ++i)
+		for ( size_t j = 0 ; j < yGrid.size(); ++j)
+			gridData.push_back(std::sin(xGrid[i])*std::cos(T(2)*yGrid[j]));
+	BiCubicInterpolation<T> interpolation(xGrid,yGrid,gridData);
+	TableFile<T>::write(fileName,interpolation);
+	MappedBiCubicInterpolation<T> mappedInterpolation(fileName);
+	if ( (mappedInterpolation.min_range_x() != xGrid.front()) or (mappedInterpolation.max_range_x() != xGrid.back())
+			or (mappedInterpolation.min_range_y() != yGrid.front()) or (mappedInterpolation.max_range_y() != yGrid.back()) ) {
+		_allSuccess = false;
+		std::cout << "Test of "<< nameOfTypeTrait<T>() << " mapped bicubic interpolation failed: wrong grid\n";
+		std::remove(fileName.c_str());
+		return;
+	}
+
+	//the gradient is compared to the one of the interpolation and to a five point difference of the mapped values
+	//	at the center of each cell, which is exact for a cubic as long as the points stay inside the cell
+	for ( size_t ix = 0 ; ix+1 < xGrid.size(); ++ix) {
+		for ( size_t iy = 0 ; iy+1 < yGrid.size(); ++iy) {
+			const T x = T(0.5)*(xGrid[ix]+xGrid[ix+1]);
+			const T y = T(0.5)*(yGrid[iy]+yGrid[iy+1]);
+			const T step = T(0.1)*std::min(xGrid[ix+1]-xGrid[ix],yGrid[iy+1]-yGrid[iy]);
+			const T gradientTolerance = T(1000)*std::numeric_limits<T>::epsilon()/step;
+			const T value = interpolation(x,y);
+			const T mappedValue = mappedInterpolation(x,y);
+			T gradX, gradY, interpolationGradX, interpolationGradY;
+			mappedInterpolation.evaluate_derivative(x,y,gradX,gradY);
+			interpolation.evaluate_derivative(x,y,interpolationGradX,interpolationGradY);
+			const T differenceX = (T(8)*(mappedInterpolation(x+step,y)-mappedInterpolation(x-step,y))
+					- (mappedInterpolation(x+2*step,y)-mappedInterpolation(x-2*step,y)))/(12*step);
+			const T differenceY = (T(8)*(mappedInterpolation(x,y+step)-mappedInterpolation(x,y-step))
+					- (mappedInterpolation(x,y+2*step)-mappedInterpolation(x,y-2*step)))/(12*step);
+			if ( (std::fabs(value-mappedValue) > tolerance*(1+std::fabs(value)))
+					or (std::fabs(gradX-interpolationGradX) > tolerance*(1+std::fabs(interpolationGradX)))
+					or (std::fabs(gradY-interpolationGradY) > tolerance*(1+std::fabs(interpolationGradY)))
+					or (std::fabs(gradX-differenceX) > gradientTolerance*(1+std::fabs(gradX)))
+					or (std::fabs(gradY-differenceY) > gradientTolerance*(1+std::fabs(gradY))) ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " mapped bicubic interpolation failed at x="
+						<< x << ", y=" << y << ":\n"
+						<< "\tvalue " << mappedValue << " instead of " << value
+						<< ", gradient (" << gradX << "," << gradY << ") instead of ("
+						<< interpolationGradX << "," << interpolationGradY << ") and about ("
+						<< differenceX << "," << differenceY << ")\n";
+				std::remove(fileName.c_str());
+				return;
+			}
+		}
+	}
+	std::remove(fileName.c_str());
+}
+
+template<typename T>
+void RunTest::test_spline_modification() {
+
+	//data with steps, flat parts and changes of the monotonicity, such that the adjustment of the
+	//	derivatives in the monotone spline takes all branches
+	auto dataAt = [] (size_t i) {
+		const T x = T(i) + T(0.3)*std::sin(T(i));
+		return ( i % 7 == 3 ? T(1) : T(3)*std::sin(T(0.4)*x) + T(0.05)*x + ( i % 5 == 0 ? T(2) : T(0) ) );
+	};
+	std::vector<T> xValues;
+	std::vector<T> dataSet;
+	for ( size_t i = 0 ; i < 60; ++i){
+		xValues.push_back(T(i) + T(0.3)*std::sin(T(i)));
+		dataSet.push_back(dataAt(i));
+	}
+	gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > cubeSpline;
+	cubeSpline.initialize(xValues,dataSet);
+	MonotoneCubeHermiteSpline<T> hermiteSpline(xValues,dataSet);
+
+	//append, remove and change points and compare to a spline of the modified data from the scratch.
+	//	The monotone spline must be identical, the cubic spline agrees up to the decay over the update window.
+	size_t nextPoint = xValues.size();
+	for ( size_t step = 0 ; step < 150; ++step ) {
+		std::string modification;
+		if ( step % 3 == 0 ) {
+			const size_t i = (step*13) % xValues.size();
+			dataSet[i] = T(0.5)*dataSet[i] - T(1);
+			cubeSpline.update(i,dataSet[i]);
+			hermiteSpline.update(i,dataSet[i]);
+			modification = "update of point " + std::to_string(i);
+		} else if ( step % 3 == 1 ) {
+			xValues.push_back(T(nextPoint) + T(0.3)*std::sin(T(nextPoint)));
+			dataSet.push_back(dataAt(nextPoint++));
+			cubeSpline.append(xValues.back(),dataSet.back());
+			hermiteSpline.append(xValues.back(),dataSet.back());
+			modification = "append";
+		} else {
+			xValues.erase(xValues.begin());
+			dataSet.erase(dataSet.begin());
+			cubeSpline.pop_front();
+			hermiteSpline.pop_front();
+			modification = "removal of the first point";
+		}
+
+		gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > cubeSplineReference;
+		cubeSplineReference.initialize(xValues,dataSet);
+		MonotoneCubeHermiteSpline<T> hermiteSplineReference(xValues,dataSet);
+		if ( (cubeSpline.num_polynomials() != xValues.size()-1) or (hermiteSpline.num_polynomials() != xValues.size()-1)
+				or (cubeSpline.min_range() != xValues.front()) or (hermiteSpline.max_range() != xValues.back()) ) {
+			_allSuccess = false;
+			std::cout << "Test of "<< nameOfTypeTrait<T>() << " spline modification failed after the "
+					<< modification << " in step " << step << ": wrong mesh\n";
+			return;
+		}
+		std::vector<T> derivatives = cubeSpline.deriviatives_at_underlying_grid_points();
+		std::vector<T> derivativesReference = cubeSplineReference.deriviatives_at_underlying_grid_points();
+		std::vector<T> hermiteDerivatives = hermiteSpline.deriviatives_at_underlying_grid_points();
+		std::vector<T> hermiteDerivativesReference = hermiteSplineReference.deriviatives_at_underlying_grid_points();
+		for ( size_t i = 0 ; i+1 < xValues.size(); ++i) {
+			const T xMid = (xValues[i]+xValues[i+1])*T(0.5);
+			if ( (hermiteSpline(xMid) != hermiteSplineReference(xMid))
+					or (hermiteDerivatives[i] != hermiteDerivativesReference[i])
+					or (std::fabs(cubeSpline(xMid)-cubeSplineReference(xMid)) > T(100)*std::numeric_limits<T>::epsilon())
+					or (std::fabs(derivatives[i]-derivativesReference[i]) > T(100)*std::numeric_limits<T>::epsilon()) ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " spline modification failed after the "
+						<< modification << " in step " << step << " at x=" << xMid << ":\n"
+						<< "\tmonotone spline " << hermiteSpline(xMid) << " instead of " << hermiteSplineReference(xMid)
+						<< ", cubic spline " << cubeSpline(xMid) << " instead of " << cubeSplineReference(xMid) << "\n";
+				return;
+			}
+		}
+	}
+}
+
+template<typename T>
+void RunTest::test_parallel_initialization() {
+
+	//a mesh that is split into 4 chunks with the data of the modification test. The plateau across the border of
+	//	the second and the third chunk carries the entering state of the adjustment over the border.
+	const size_t numPoints = 4*gslpp::auxillary::minItemsPerThread + 1;
+	const size_t border = numPoints/2;
+	std::vector<T> xValues(numPoints);
+	std::vector<T> dataSet(numPoints);
+	for ( size_t i = 0 ; i < numPoints; ++i){
+		xValues[i] = T(i) + T(0.3)*std::sin(T(i));
+		dataSet[i] = ( i % 7 == 3 ? T(1) : T(3)*std::sin(T(0.4)*xValues[i]) + T(0.05)*xValues[i] + ( i % 5 == 0 ? T(2) : T(0) ) );
+		if ( (i+5 > border) and (i < border+5) )
+			dataSet[i] = dataSet[border-5];
+	}
+
+	//the result must not depend on the number of threads
+	MonotoneCubeHermiteSpline<T> serialSpline;
+	serialSpline.set_num_threads(1);
+	serialSpline.initialize(xValues,dataSet);
+	MonotoneCubeHermiteSpline<T> parallelSpline;
+	parallelSpline.set_num_threads(4);
+	parallelSpline.initialize(xValues,dataSet);
+
+	std::vector<T> derivatives = serialSpline.deriviatives_at_underlying_grid_points();
+	std::vector<T> parallelDerivatives = parallelSpline.deriviatives_at_underlying_grid_points();
+	for ( size_t i = 0 ; i+1 < numPoints; ++i) {
+		const T xMid = (xValues[i]+xValues[i+1])*T(0.5);
+		if ( (parallelSpline(xMid) != serialSpline(xMid)) or (parallelDerivatives[i] != derivatives[i]) ) {
+			_allSuccess = false;
+			std::cout << "Test of "<< nameOfTypeTrait<T>() << " parallel initialization failed at x=" << xMid << ":\n"
+					<< "\tvalue " << parallelSpline(xMid) << " instead of " << serialSpline(xMid)
+					<< ", derivative " << parallelDerivatives[i] << " instead of " << derivatives[i] << "\n";
+			return;
+		}
+	}
+	if ( parallelDerivatives.back() != derivatives.back() ) {
+		_allSuccess = false;
+		std::cout << "Test of "<< nameOfTypeTrait<T>() << " parallel initialization failed at the last point\n";
+	}
+
+	//the first modification sets up the state of the adjustment from the polynomials. The result must be
+	//	identical to a new initialization with the modified data.
+	dataSet[border+2] = T(-3);
+	parallelSpline.update(border+2,dataSet[border+2]);
+	xValues.push_back(xValues.back()+T(1));
+	dataSet.push_back(T(0));
+	parallelSpline.append(xValues.back(),dataSet.back());
+	serialSpline.initialize(xValues,dataSet);
+	if ( parallelSpline.deriviatives_at_underlying_grid_points() != serialSpline.deriviatives_at_underlying_grid_points() ) {
+		_allSuccess = false;
+		std::cout << "Test of "<< nameOfTypeTrait<T>() << " parallel initialization failed after a modification\n";
+	}
+}
+
+template<typename T>
+void RunTest::test_inverse_evaluation() {
+
+	//an increasing data set with a plateau and a decreasing one on the same mesh
+	const size_t numPoints = 40;
+	const size_t plateauBegin = 10;
+	std::vector<T> xValues;
+	std::vector<T> increasingData;
+	std::vector<T> decreasingData;
+	for ( size_t i = 0 ; i < numPoints; ++i){
+		xValues.push_back(T(0.5)*T(i) + T(0.1)*std::sin(T(i)));
+		increasingData.push_back( (i > plateauBegin) and (i < plateauBegin+5) ? increasingData[plateauBegin]
+				: xValues.back() + T(0.8)*std::sin(xValues.back()) );
+		decreasingData.push_back( T(5)*std::exp(-T(0.3)*xValues.back()) );
+	}
+
+	for ( auto const& dataSet : {increasingData, decreasingData} ) {
+		MonotoneCubeHermiteSpline<T> spline(xValues,dataSet);
+		const bool increasing = (dataSet.back() > dataSet.front());
+		const T scale = std::max(std::fabs(dataSet.front()),std::fabs(dataSet.back()));
+
+		//values in an unsorted order, the value of the plateau and values outside of the data
+		std::vector<T> ys;
+		for ( size_t k = 0 ; k < 301; ++k)
+			ys.push_back(dataSet.front() + (dataSet.back()-dataSet.front())*T((k*37) % 301)/T(301));
+		ys.push_back(dataSet[plateauBegin]);
+		ys.push_back(dataSet.front() - (dataSet.back()-dataSet.front()));
+		ys.push_back(dataSet.back() + (dataSet.back()-dataSet.front()));
+		std::vector<T> xs(ys.size());
+		spline.evaluate_inverse(ys.data(),xs.data(),ys.size());
+
+		for ( size_t k = 0 ; k < ys.size(); ++k) {
+			bool success = true;
+			if ( k+2 < ys.size() ) {
+				success = (std::fabs(spline(xs[k]) - ys[k]) <= T(100)*std::numeric_limits<T>::epsilon()*scale)
+						and (std::fabs(spline(spline.evaluate_inverse(ys[k])) - ys[k]) <= T(100)*std::numeric_limits<T>::epsilon()*scale);
+			} else {
+				const T xEnd = ( k+2 == ys.size() ? xValues.front() : xValues.back() );
+				success = (std::fabs(xs[k] - xEnd) <= T(4)*std::numeric_limits<T>::epsilon()*xValues.back());
+			}
+			//the spline is flat at the end of the interval before the plateau, which limits the accuracy of the position
+			if ( increasing and (k+3 == ys.size()) )
+				success = success and (std::fabs(xs[k] - xValues[plateauBegin]) <= std::sqrt(std::numeric_limits<T>::epsilon()));
+			if ( not success ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " inverse evaluation of the "
+						<< (increasing ? "increasing" : "decreasing") << " spline failed for y=" << ys[k] << ":\n"
+						<< "\tposition " << xs[k] << " with the value " << spline(xs[k]) << "\n";
+				return;
+			}
+		}
+	}
+}
+
+template<typename T>
+void RunTest::test_MultiSpline() {
+
+	//each column of the multi spline must agree with the cubic spline through the column
+	const size_t numPoints = 40;
+	const size_t numColumns = 7;
+	std::vector<T> xValues(numPoints);
+	std::vector<T> data(numPoints*numColumns);
+	for ( size_t i = 0 ; i < numPoints; ++i){
+		xValues[i] = T(i) + T(0.3)*std::sin(T(i));
+		for ( size_t j = 0 ; j < numColumns; ++j)
+			data[i*numColumns+j] = std::sin(T(0.2)*T(j+1)*xValues[i]) + T(j);
+	}
+	MultiSpline<T> multiSpline(xValues,data,numColumns);
+
+	const T tolerance = T(100)*std::numeric_limits<T>::epsilon();
+	std::vector<T> values(numColumns), derivatives(numColumns), column(numPoints);
+	for ( size_t j = 0 ; j < numColumns; ++j) {
+		for ( size_t i = 0 ; i < numPoints; ++i)
+			column[i] = data[i*numColumns+j];
+		gslpp::data_interpolation::CubeSpline<T,CubicPolynomial<T> > cubeSpline;
+		cubeSpline.initialize(xValues,column);
+		for ( size_t k = 0 ; k < 200; ++k) {
+			const T x = xValues.front() + (xValues.back()-xValues.front())*T(k)/T(200);
+			T value, derivative;
+			cubeSpline.evaluate(x,value,derivative);
+			multiSpline.evaluate(x,values.data(),derivatives.data());
+			if ( (std::fabs(values[j]-value) > tolerance*(1+std::fabs(value)))
+					or (std::fabs(derivatives[j]-derivative) > tolerance*(1+std::fabs(derivative))) ) {
+				_allSuccess = false;
+				std::cout << "Test of "<< nameOfTypeTrait<T>() << " multi spline failed for column " << j
+						<< " at x=" << x << ": value " << values[j] << " instead of " << value
+						<< ", derivative " << derivatives[j] << " instead of " << derivative << "\n";
+				return;
+			}
+		}
+	}
+}
+
 template<typename T>
 void RunTest::test_HermitePolynomial() {
 
@@ -253,11 +983,12 @@ void RunTest::test_CubeSpline2D(){
 	cubeSpline.initialize(xValues,dataSet1);
 
 	//compare the data along the x axis with the pure spline
-	// both interpolations will not be equal expect for the input data points
-	//	and the derivative at this points.
-	for ( size_t i = 0 ; i < xValues.size()-1 ; i++){
+	// since the data does not depend on y, both interpolations are equal at the input data points
+	//	and in between, for the values and the derivatives.
+	for ( size_t k = 0 ; k < 2*(xValues.size()-1) ; k++){
 
-		T x = xValues[i];
+		const size_t i = k/2;
+		T x = ( k%2 == 0 ? xValues[i] : T(0.5)*(xValues[i]+xValues[i+1]) );
 		T y = -0.2423;
 
 		T diffValue = cubeSpline2d(x,y) - cubeSpline(x);
@@ -295,11 +1026,12 @@ void RunTest::test_CubeSpline2D(){
 	monontoneSpline.initialize(xValues,dataSet1);
 
 	//compare the data along the x axis with the pure spline
-	// both interpolations will not be equal expect for the input data points
-	//	and the derivative at this points.
-	for ( size_t i = 0 ; i < xValues.size()-1 ; i++){
+	// since the data does not depend on y, both interpolations are equal at the input data points
+	//	and in between, for the values and the derivatives.
+	for ( size_t k = 0 ; k < 2*(xValues.size()-1) ; k++){
 
-		T x = xValues[i];
+		const size_t i = k/2;
+		T x = ( k%2 == 0 ? xValues[i] : T(0.5)*(xValues[i]+xValues[i+1]) );
 		T y = -0.2423;
 
 		T diffValue = monotoneSpline2d(x,y) - monontoneSpline(x);
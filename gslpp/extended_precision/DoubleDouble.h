@@ -0,0 +1,124 @@
+/*
+ * DoubleDouble.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_EXTENDED_PRECISION_DOUBLEDOUBLE_H_
+#define GSLPP_EXTENDED_PRECISION_DOUBLEDOUBLE_H_
+
+#include "gslpp/auxillary/AccuracyGoal.h"
+#include <cstddef>
+#include <ostream>
+
+namespace gslpp {
+namespace extended_precision {
+
+/**
+ * 	A floating point number with about 106 bits of mantissa, represented by the unevaluated sum of two doubles.
+ *
+ * 	The value is hi + lo with |lo| <= ulp(hi)/2. The arithmetic uses error-free transformations
+ * 	based on the FMA instruction (if FP_FAST_FMA is defined, Dekker's splitting otherwise) such that the
+ * 	type is only a few times slower than double. The range of exponents is the one of double.
+ */
+class DoubleDouble {
+public:
+
+	/**
+	 * Construct the number hi + lo. The caller must ensure that |lo| <= ulp(hi)/2.
+	 *
+	 * @param hi The leading part.
+	 * @param lo The trailing part.
+	 */
+	constexpr DoubleDouble(double hi = 0.0, double lo = 0.0) : _hi(hi), _lo(lo) { };
+
+	/**	@return The leading part */
+	constexpr double hi() const { return _hi; };
+
+	/**	@return The trailing part */
+	constexpr double lo() const { return _lo; };
+
+	/**
+	 * @param i Index of the part, 0 for the leading and 1 for the trailing part.
+	 * @return The part i.
+	 */
+	constexpr double operator[] (size_t i) const { return i == 0 ? _hi : _lo; };
+
+	/**	@return The number rounded to double */
+	explicit constexpr operator double () const { return _hi; };
+
+	DoubleDouble & operator+= (DoubleDouble const& b);
+	DoubleDouble & operator-= (DoubleDouble const& b);
+	DoubleDouble & operator*= (DoubleDouble const& b);
+	DoubleDouble & operator/= (DoubleDouble const& b);
+private:
+
+	double _hi;
+
+	double _lo;
+};
+
+inline DoubleDouble operator+ (DoubleDouble const& a, DoubleDouble const& b);
+inline DoubleDouble operator+ (DoubleDouble const& a, double b);
+inline DoubleDouble operator+ (double a, DoubleDouble const& b);
+
+inline DoubleDouble operator- (DoubleDouble const& a);
+inline DoubleDouble operator- (DoubleDouble const& a, DoubleDouble const& b);
+inline DoubleDouble operator- (DoubleDouble const& a, double b);
+inline DoubleDouble operator- (double a, DoubleDouble const& b);
+
+inline DoubleDouble operator* (DoubleDouble const& a, DoubleDouble const& b);
+inline DoubleDouble operator* (DoubleDouble const& a, double b);
+inline DoubleDouble operator* (double a, DoubleDouble const& b);
+
+inline DoubleDouble operator/ (DoubleDouble const& a, DoubleDouble const& b);
+inline DoubleDouble operator/ (DoubleDouble const& a, double b);
+
+inline bool operator== (DoubleDouble const& a, DoubleDouble const& b);
+inline bool operator!= (DoubleDouble const& a, DoubleDouble const& b);
+inline bool operator< (DoubleDouble const& a, DoubleDouble const& b);
+inline bool operator> (DoubleDouble const& a, DoubleDouble const& b);
+inline bool operator<= (DoubleDouble const& a, DoubleDouble const& b);
+inline bool operator>= (DoubleDouble const& a, DoubleDouble const& b);
+
+/**	@return The absolute value of a. */
+inline DoubleDouble fabs(DoubleDouble const& a);
+
+/**	@return The absolute value of a. */
+inline DoubleDouble abs(DoubleDouble const& a);
+
+/**	@return The square root of a, computed by one Newton step from the double precision square root. */
+inline DoubleDouble sqrt(DoubleDouble const& a);
+
+/**
+ * Write the decimal representation of a with out.precision() significant digits, at most 32.
+ */
+inline std::ostream & operator<< (std::ostream & out, DoubleDouble const& a);
+
+} /* namespace extended_precision */
+
+namespace auxillary {
+
+/// @cond Doxygen_suppress
+namespace detail {
+//A static data member of class type that is odr-used needs a definition outside the class.
+//	For a template this definition can be placed in the header.
+template<typename dummy>
+struct AccuracyGoalDoubleDouble {
+	constexpr static extended_precision::DoubleDouble value = extended_precision::DoubleDouble(1e-28);
+};
+
+template<typename dummy>
+constexpr extended_precision::DoubleDouble AccuracyGoalDoubleDouble<dummy>::value;
+} /* namespace detail */
+/// @endcond
+
+template<>
+struct AccuracyGoal<extended_precision::DoubleDouble> : detail::AccuracyGoalDoubleDouble<void> { };
+
+} /* namespace auxillary */
+} /* namespace gslpp */
+
+#include "gslpp/extended_precision/src/DoubleDouble.hpp"
+#endif /* GSLPP_EXTENDED_PRECISION_DOUBLEDOUBLE_H_ */
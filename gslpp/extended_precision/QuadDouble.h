@@ -0,0 +1,117 @@
+/*
+ * QuadDouble.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_EXTENDED_PRECISION_QUADDOUBLE_H_
+#define GSLPP_EXTENDED_PRECISION_QUADDOUBLE_H_
+
+#include "gslpp/extended_precision/DoubleDouble.h"
+#include "gslpp/auxillary/AccuracyGoal.h"
+#include <cstddef>
+#include <ostream>
+
+namespace gslpp {
+namespace extended_precision {
+
+/**
+ * 	A floating point number with about 212 bits of mantissa, represented by the unevaluated sum of four doubles.
+ *
+ * 	The parts x0 + x1 + x2 + x3 do not overlap and decrease in magnitude. The arithmetic follows the
+ * 	quad-double algorithms of Hida, Li and Bailey using the error-free transformations of DoubleDouble.
+ * 	The addition has an error below 2^(-209)(|a|+|b|) instead of a correctly rounded result.
+ */
+class QuadDouble {
+public:
+
+	/**
+	 * Construct the number x0 + x1 + x2 + x3. The caller must ensure that the parts do not overlap.
+	 */
+	constexpr QuadDouble(double x0 = 0.0, double x1 = 0.0, double x2 = 0.0, double x3 = 0.0)
+		: _x{x0, x1, x2, x3} { };
+
+	/**	Construct from the exact value of a DoubleDouble */
+	constexpr QuadDouble(DoubleDouble const& a) : _x{a.hi(), a.lo(), 0.0, 0.0} { };
+
+	/**
+	 * @param i Index of the part, 0 for the leading part.
+	 * @return The part i.
+	 */
+	constexpr double operator[] (size_t i) const { return _x[i]; };
+
+	/**	@return The number rounded to double */
+	explicit constexpr operator double () const { return _x[0]; };
+
+	QuadDouble & operator+= (QuadDouble const& b);
+	QuadDouble & operator-= (QuadDouble const& b);
+	QuadDouble & operator*= (QuadDouble const& b);
+	QuadDouble & operator/= (QuadDouble const& b);
+private:
+
+	double _x[4];
+};
+
+inline QuadDouble operator+ (QuadDouble const& a, QuadDouble const& b);
+inline QuadDouble operator+ (QuadDouble const& a, double b);
+inline QuadDouble operator+ (double a, QuadDouble const& b);
+
+inline QuadDouble operator- (QuadDouble const& a);
+inline QuadDouble operator- (QuadDouble const& a, QuadDouble const& b);
+inline QuadDouble operator- (QuadDouble const& a, double b);
+inline QuadDouble operator- (double a, QuadDouble const& b);
+
+inline QuadDouble operator* (QuadDouble const& a, QuadDouble const& b);
+inline QuadDouble operator* (QuadDouble const& a, double b);
+inline QuadDouble operator* (double a, QuadDouble const& b);
+
+inline QuadDouble operator/ (QuadDouble const& a, QuadDouble const& b);
+inline QuadDouble operator/ (QuadDouble const& a, double b);
+
+inline bool operator== (QuadDouble const& a, QuadDouble const& b);
+inline bool operator!= (QuadDouble const& a, QuadDouble const& b);
+inline bool operator< (QuadDouble const& a, QuadDouble const& b);
+inline bool operator> (QuadDouble const& a, QuadDouble const& b);
+inline bool operator<= (QuadDouble const& a, QuadDouble const& b);
+inline bool operator>= (QuadDouble const& a, QuadDouble const& b);
+
+/**	@return The absolute value of a. */
+inline QuadDouble fabs(QuadDouble const& a);
+
+/**	@return The absolute value of a. */
+inline QuadDouble abs(QuadDouble const& a);
+
+/**	@return The square root of a, computed by Newton steps for 1/sqrt(a) starting from double precision. */
+inline QuadDouble sqrt(QuadDouble const& a);
+
+/**
+ * Write the decimal representation of a with out.precision() significant digits, at most 64.
+ */
+inline std::ostream & operator<< (std::ostream & out, QuadDouble const& a);
+
+} /* namespace extended_precision */
+
+namespace auxillary {
+
+/// @cond Doxygen_suppress
+namespace detail {
+//see AccuracyGoalDoubleDouble
+template<typename dummy>
+struct AccuracyGoalQuadDouble {
+	constexpr static extended_precision::QuadDouble value = extended_precision::QuadDouble(1e-56);
+};
+
+template<typename dummy>
+constexpr extended_precision::QuadDouble AccuracyGoalQuadDouble<dummy>::value;
+} /* namespace detail */
+/// @endcond
+
+template<>
+struct AccuracyGoal<extended_precision::QuadDouble> : detail::AccuracyGoalQuadDouble<void> { };
+
+} /* namespace auxillary */
+} /* namespace gslpp */
+
+#include "gslpp/extended_precision/src/QuadDouble.hpp"
+#endif /* GSLPP_EXTENDED_PRECISION_QUADDOUBLE_H_ */
@@ -0,0 +1,230 @@
+/*
+ * DoubleDouble.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/extended_precision/DoubleDouble.h"
+#include "gslpp/extended_precision/src/ErrorFreeTransformations.hpp"
+#include "gslpp/extended_precision/src/MultiDoubleSupport.hpp"
+#include "gslpp/float_comparison/FloatComparison.h"
+#include <cmath>
+#include <limits>
+
+//see the comment in ErrorFreeTransformations.hpp
+#ifdef __FAST_MATH__
+#pragma GCC push_options
+#pragma GCC optimize ("no-fast-math")
+#endif
+
+namespace gslpp {
+namespace extended_precision {
+
+inline DoubleDouble operator+ (DoubleDouble const& a, DoubleDouble const& b) {
+	//the sum of the trailing parts is added separately such that the sum is accurate
+	//	also in case of cancellation of the leading parts
+	double s1, s2, t1, t2;
+	s1 = detail::two_sum(a.hi(), b.hi(), s2);
+	t1 = detail::two_sum(a.lo(), b.lo(), t2);
+	s2 += t1;
+	s1 = detail::quick_two_sum(s1, s2, s2);
+	s2 += t2;
+	s1 = detail::quick_two_sum(s1, s2, s2);
+	return DoubleDouble(s1, s2);
+}
+
+inline DoubleDouble operator+ (DoubleDouble const& a, double b) {
+	double s1, s2;
+	s1 = detail::two_sum(a.hi(), b, s2);
+	s2 += a.lo();
+	s1 = detail::quick_two_sum(s1, s2, s2);
+	return DoubleDouble(s1, s2);
+}
+
+inline DoubleDouble operator+ (double a, DoubleDouble const& b) {
+	return b + a;
+}
+
+inline DoubleDouble operator- (DoubleDouble const& a) {
+	return DoubleDouble(-a.hi(), -a.lo());
+}
+
+inline DoubleDouble operator- (DoubleDouble const& a, DoubleDouble const& b) {
+	return a + (-b);
+}
+
+inline DoubleDouble operator- (DoubleDouble const& a, double b) {
+	return a + (-b);
+}
+
+inline DoubleDouble operator- (double a, DoubleDouble const& b) {
+	return (-b) + a;
+}
+
+inline DoubleDouble operator* (DoubleDouble const& a, DoubleDouble const& b) {
+	double p1, p2;
+	p1 = detail::two_prod(a.hi(), b.hi(), p2);
+	p2 += (a.hi() * b.lo() + a.lo() * b.hi());
+	p1 = detail::quick_two_sum(p1, p2, p2);
+	return DoubleDouble(p1, p2);
+}
+
+inline DoubleDouble operator* (DoubleDouble const& a, double b) {
+	double p1, p2;
+	p1 = detail::two_prod(a.hi(), b, p2);
+	p2 += a.lo() * b;
+	p1 = detail::quick_two_sum(p1, p2, p2);
+	return DoubleDouble(p1, p2);
+}
+
+inline DoubleDouble operator* (double a, DoubleDouble const& b) {
+	return b * a;
+}
+
+inline DoubleDouble operator/ (DoubleDouble const& a, DoubleDouble const& b) {
+	//long division with three quotient terms
+	double q1, q2, q3;
+	q1 = a.hi() / b.hi();
+	DoubleDouble r = a - b * q1;
+	q2 = r.hi() / b.hi();
+	r = r - b * q2;
+	q3 = r.hi() / b.hi();
+	q1 = detail::quick_two_sum(q1, q2, q2);
+	return DoubleDouble(q1, q2) + q3;
+}
+
+inline DoubleDouble operator/ (DoubleDouble const& a, double b) {
+	double q1, q2, p1, p2, s, e;
+	q1 = a.hi() / b;
+	p1 = detail::two_prod(q1, b, p2);
+	s = detail::two_diff(a.hi(), p1, e);
+	e -= p2;
+	e += a.lo();
+	q2 = (s + e) / b;
+	q1 = detail::quick_two_sum(q1, q2, q2);
+	return DoubleDouble(q1, q2);
+}
+
+inline DoubleDouble & DoubleDouble::operator+= (DoubleDouble const& b) {
+	*this = *this + b;
+	return *this;
+}
+
+inline DoubleDouble & DoubleDouble::operator-= (DoubleDouble const& b) {
+	*this = *this - b;
+	return *this;
+}
+
+inline DoubleDouble & DoubleDouble::operator*= (DoubleDouble const& b) {
+	*this = *this * b;
+	return *this;
+}
+
+inline DoubleDouble & DoubleDouble::operator/= (DoubleDouble const& b) {
+	*this = *this / b;
+	return *this;
+}
+
+inline DoubleDouble sqrt(DoubleDouble const& a) {
+	if ( a.hi() <= 0.0 )
+		return ( a.hi() == 0.0 ? DoubleDouble(0.0) : DoubleDouble(std::numeric_limits<double>::quiet_NaN()) );
+
+	//one Newton step for 1/sqrt(a) doubles the number of correct digits: sqrt(a) ~ ax + (a - ax^2) x/2
+	double x = 1.0 / std::sqrt(a.hi());
+	double ax = a.hi() * x;
+	double axSquaredLo;
+	double axSquaredHi = detail::two_prod(ax, ax, axSquaredLo);
+	return DoubleDouble(ax) + (a - DoubleDouble(axSquaredHi, axSquaredLo)).hi() * (x * 0.5);
+}
+
+} /* namespace extended_precision */
+} /* namespace gslpp */
+
+#ifdef __FAST_MATH__
+#pragma GCC pop_options
+#endif
+
+namespace gslpp {
+namespace extended_precision {
+
+inline bool operator== (DoubleDouble const& a, DoubleDouble const& b) {
+	return (a.hi() == b.hi()) and (a.lo() == b.lo());
+}
+
+inline bool operator!= (DoubleDouble const& a, DoubleDouble const& b) {
+	return not (a == b);
+}
+
+inline bool operator< (DoubleDouble const& a, DoubleDouble const& b) {
+	return (a.hi() < b.hi()) or ( (a.hi() == b.hi()) and (a.lo() < b.lo()) );
+}
+
+inline bool operator> (DoubleDouble const& a, DoubleDouble const& b) {
+	return b < a;
+}
+
+inline bool operator<= (DoubleDouble const& a, DoubleDouble const& b) {
+	return not (b < a);
+}
+
+inline bool operator>= (DoubleDouble const& a, DoubleDouble const& b) {
+	return not (a < b);
+}
+
+inline DoubleDouble fabs(DoubleDouble const& a) {
+	return ( a.hi() < 0.0 ? -a : a );
+}
+
+inline DoubleDouble abs(DoubleDouble const& a) {
+	return fabs(a);
+}
+
+inline std::ostream & operator<< (std::ostream & out, DoubleDouble const& a) {
+	return detail::write_decimal<DoubleDouble,32>(out,a);
+}
+
+} /* namespace extended_precision */
+
+namespace float_comparison {
+
+/// @cond Doxygen_suppress
+template<>
+struct is_NaN_impl< extended_precision::DoubleDouble > {
+	static bool is_NaN_call( extended_precision::DoubleDouble a ) {
+		return is_NaN<double>( a.hi() ) or is_NaN<double>( a.lo() );
+	};
+};
+
+template<>
+struct equal_up_to_significant_digits_binary_impl< extended_precision::DoubleDouble > {
+	static bool equal_up_to_significant_digits_binary_call(
+			extended_precision::DoubleDouble a, extended_precision::DoubleDouble b, int significantDigits) {
+		return extended_precision::detail::equal_up_to_significant_digits_binary<
+				extended_precision::DoubleDouble,105>(a,b,significantDigits);
+	};
+};
+
+template<>
+struct equal_up_to_significant_digits_decimal_impl< extended_precision::DoubleDouble > {
+	static bool equal_up_to_significant_digits_decimal_call(
+			extended_precision::DoubleDouble a, extended_precision::DoubleDouble b, int significantDigits) {
+		const int significantDigitsBase2 = std::ceil(significantDigits/0.3010299957);
+		return equal_up_to_significant_digits_binary(a,b,105+1-significantDigitsBase2);
+	};
+};
+
+template<>
+struct equal_up_to_significant_digits_decimal_above_threshold_impl< extended_precision::DoubleDouble > {
+	static bool equal_up_to_significant_digits_decimal_above_threshold_call(
+			extended_precision::DoubleDouble a, extended_precision::DoubleDouble b,
+			int significantDigits, extended_precision::DoubleDouble threshold){
+		if ( (fabs( b ) < threshold) and (fabs(a ) < threshold) )
+			return true;
+		return equal_up_to_significant_digits_decimal(a,b,significantDigits);
+	}
+};
+/// @endcond
+
+} /* namespace float_comparison */
+} /* namespace gslpp */
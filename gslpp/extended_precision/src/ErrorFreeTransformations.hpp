@@ -0,0 +1,144 @@
+/*
+ * ErrorFreeTransformations.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_EXTENDED_PRECISION_ERRORFREETRANSFORMATIONS_HPP_
+#define GSLPP_EXTENDED_PRECISION_ERRORFREETRANSFORMATIONS_HPP_
+
+#include <cmath>
+
+//The error-free transformations rely on the exact rounding of each single operation.
+//	Reassociation as allowed by -ffast-math (see make.sys.release) would cancel the error terms.
+//	The region is thus compiled without it, which prevents the inlining into fast-math callers.
+#ifdef __FAST_MATH__
+#pragma GCC push_options
+#pragma GCC optimize ("no-fast-math")
+#endif
+
+namespace gslpp {
+namespace extended_precision {
+namespace detail {
+
+/// @cond Doxygen_suppress
+
+//s + err = a + b exactly, provided |a| >= |b|
+inline double quick_two_sum(double a, double b, double &err) {
+	double s = a + b;
+	err = b - (s - a);
+	return s;
+}
+
+//s + err = a + b exactly
+inline double two_sum(double a, double b, double &err) {
+	double s = a + b;
+	double bb = s - a;
+	err = (a - (s - bb)) + (b - bb);
+	return s;
+}
+
+//s + err = a - b exactly
+inline double two_diff(double a, double b, double &err) {
+	double s = a - b;
+	double bb = s - a;
+	err = (a - (s - bb)) - (b + bb);
+	return s;
+}
+
+//p + err = a * b exactly. With a hardware FMA this is a single instruction, otherwise we
+//	split the factors into 26 bit halves following Dekker.
+inline double two_prod(double a, double b, double &err) {
+	double p = a * b;
+#ifdef FP_FAST_FMA
+	err = std::fma(a,b,-p);
+#else
+	const double splitter = 134217729.0; // 2^27+1
+	double t = splitter * a;
+	double aHi = t - (t - a);
+	double aLo = a - aHi;
+	t = splitter * b;
+	double bHi = t - (t - b);
+	double bLo = b - bHi;
+	err = ((aHi * bHi - p) + aHi * bLo + aLo * bHi) + aLo * bLo;
+#endif
+	return p;
+}
+
+//on output a + b + c is the exact sum of the input, where a is the leading term
+inline void three_sum(double &a, double &b, double &c) {
+	double t1, t2, t3;
+	t1 = two_sum(a, b, t2);
+	a  = two_sum(c, t1, t3);
+	b  = two_sum(t2, t3, c);
+}
+
+//on output a + b is the sum of a, b and c, where a is the leading term
+inline void three_sum2(double &a, double &b, double &c) {
+	double t1, t2, t3;
+	t1 = two_sum(a, b, t2);
+	a  = two_sum(c, t1, t3);
+	b = t2 + t3;
+}
+
+//renormalize five overlapping terms to four non-overlapping terms c0 ... c3
+inline void renormalize(double &c0, double &c1, double &c2, double &c3, double c4) {
+	double s0, s1, s2 = 0.0, s3 = 0.0;
+
+	s0 = quick_two_sum(c3, c4, c4);
+	s0 = quick_two_sum(c2, s0, c3);
+	s0 = quick_two_sum(c1, s0, c2);
+	c0 = quick_two_sum(c0, s0, c1);
+
+	s0 = c0;
+	s1 = c1;
+	if (s1 != 0.0) {
+		s1 = quick_two_sum(s1, c2, s2);
+		if (s2 != 0.0) {
+			s2 = quick_two_sum(s2, c3, s3);
+			if (s3 != 0.0)
+				s3 += c4;
+			else
+				s2 = quick_two_sum(s2, c4, s3);
+		} else {
+			s1 = quick_two_sum(s1, c3, s2);
+			if (s2 != 0.0)
+				s2 = quick_two_sum(s2, c4, s3);
+			else
+				s1 = quick_two_sum(s1, c4, s2);
+		}
+	} else {
+		s0 = quick_two_sum(s0, c2, s1);
+		if (s1 != 0.0) {
+			s1 = quick_two_sum(s1, c3, s2);
+			if (s2 != 0.0)
+				s2 = quick_two_sum(s2, c4, s3);
+			else
+				s1 = quick_two_sum(s1, c4, s2);
+		} else {
+			s0 = quick_two_sum(s0, c3, s1);
+			if (s1 != 0.0)
+				s1 = quick_two_sum(s1, c4, s2);
+			else
+				s0 = quick_two_sum(s0, c4, s1);
+		}
+	}
+
+	c0 = s0;
+	c1 = s1;
+	c2 = s2;
+	c3 = s3;
+}
+
+/// @endcond
+
+} /* namespace detail */
+} /* namespace extended_precision */
+} /* namespace gslpp */
+
+#ifdef __FAST_MATH__
+#pragma GCC pop_options
+#endif
+
+#endif /* GSLPP_EXTENDED_PRECISION_ERRORFREETRANSFORMATIONS_HPP_ */
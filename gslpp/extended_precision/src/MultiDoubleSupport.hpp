@@ -0,0 +1,102 @@
+/*
+ * MultiDoubleSupport.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_EXTENDED_PRECISION_MULTIDOUBLESUPPORT_HPP_
+#define GSLPP_EXTENDED_PRECISION_MULTIDOUBLESUPPORT_HPP_
+
+#include "gslpp/float_comparison/FloatComparison.h"
+#include <ostream>
+#include <string>
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+namespace gslpp {
+namespace extended_precision {
+namespace detail {
+
+/// @cond Doxygen_suppress
+
+//Write the decimal representation of a number T that is the sum of doubles x[0] + x[1] + ...
+//	by extracting one digit after the other from the leading part.
+template<typename T, int maxNumDigits>
+std::ostream & write_decimal(std::ostream & out, T const& a) {
+	if ( gslpp::float_comparison::is_NaN(a[0]) )
+		return out << a[0];
+	if ( a[0] == 0.0 )
+		return out << 0.0;
+	if ( std::fabs(a[0]) > std::numeric_limits<double>::max() )
+		return out << a[0];
+
+	std::string digits;
+	if ( a[0] < 0.0 )
+		digits.push_back('-');
+	T r = fabs(a);
+
+	//scale into [1,10) by powers of ten in the precision of T
+	int exponent = static_cast<int>(std::floor(std::log10(r[0])));
+	T scale = T(1.0);
+	T ten = T(10.0);
+	for ( int e = std::abs(exponent); e > 0; e /= 2) {
+		if ( e % 2 == 1 )
+			scale = scale*ten;
+		ten = ten*ten;
+	}
+	r = ( exponent >= 0 ? r/scale : r*scale );
+	if ( r >= T(10.0) ) {
+		r = r/10.0;
+		++exponent;
+	}
+	if ( r < T(1.0) ) {
+		r = r*10.0;
+		--exponent;
+	}
+
+	const int numDigits = std::max(1,std::min(static_cast<int>(out.precision()),maxNumDigits));
+	for ( int i = 0 ; i < numDigits; ++i) {
+		int digit = static_cast<int>(std::floor(r[0]));
+		r = r - static_cast<double>(digit);
+		if ( r < T(0.0) ) {
+			--digit;
+			r = r + 1.0;
+		}
+		digits.push_back(static_cast<char>('0'+std::min(std::max(digit,0),9)));
+		if ( (i == 0) and (numDigits > 1) )
+			digits.push_back('.');
+		r = r*10.0;
+	}
+	digits.push_back('e');
+	digits += std::to_string(exponent);
+	return out << digits;
+}
+
+//Compare two numbers T that are sums of doubles x[0] + x[1] + ... in units of the last place of the full
+//	mantissa with numMantissaBits bits.
+template<typename T, int numMantissaBits>
+bool equal_up_to_significant_digits_binary(T const& a, T const& b, int significantDigits) {
+	if ( gslpp::float_comparison::is_NaN(a[0]) or gslpp::float_comparison::is_NaN(b[0]) )
+		return false;
+	if ( a == b )
+		return true;
+	T diff = fabs(a - b);
+	T maxAbs = std::max(fabs(a),fabs(b));
+	if ( (std::fabs(maxAbs[0]) > std::numeric_limits<double>::max()) or
+			(std::fabs(diff[0]) > std::numeric_limits<double>::max()) )
+		return false;
+	int exponent;
+	std::frexp(maxAbs[0],&exponent);
+	//the last place of the mantissa is 2^(exponent-1-numMantissaBits)
+	return diff[0] < std::ldexp(1.0,exponent-1-numMantissaBits+significantDigits);
+}
+
+/// @endcond
+
+} /* namespace detail */
+} /* namespace extended_precision */
+} /* namespace gslpp */
+
+#endif /* GSLPP_EXTENDED_PRECISION_MULTIDOUBLESUPPORT_HPP_ */
@@ -0,0 +1,284 @@
+/*
+ * QuadDouble.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/extended_precision/QuadDouble.h"
+#include "gslpp/extended_precision/src/ErrorFreeTransformations.hpp"
+#include "gslpp/extended_precision/src/MultiDoubleSupport.hpp"
+#include "gslpp/float_comparison/FloatComparison.h"
+#include <cmath>
+#include <limits>
+
+//see the comment in ErrorFreeTransformations.hpp
+#ifdef __FAST_MATH__
+#pragma GCC push_options
+#pragma GCC optimize ("no-fast-math")
+#endif
+
+namespace gslpp {
+namespace extended_precision {
+
+inline QuadDouble operator+ (QuadDouble const& a, QuadDouble const& b) {
+	double s0, s1, s2, s3;
+	double t0, t1, t2, t3;
+
+	s0 = detail::two_sum(a[0], b[0], t0);
+	s1 = detail::two_sum(a[1], b[1], t1);
+	s2 = detail::two_sum(a[2], b[2], t2);
+	s3 = detail::two_sum(a[3], b[3], t3);
+
+	s1 = detail::two_sum(s1, t0, t0);
+	detail::three_sum(s2, t0, t1);
+	detail::three_sum2(s3, t0, t2);
+	t0 = t0 + t1 + t3;
+
+	detail::renormalize(s0, s1, s2, s3, t0);
+	return QuadDouble(s0, s1, s2, s3);
+}
+
+inline QuadDouble operator+ (QuadDouble const& a, double b) {
+	double c0, c1, c2, c3, e;
+
+	c0 = detail::two_sum(a[0], b, e);
+	c1 = detail::two_sum(a[1], e, e);
+	c2 = detail::two_sum(a[2], e, e);
+	c3 = detail::two_sum(a[3], e, e);
+
+	detail::renormalize(c0, c1, c2, c3, e);
+	return QuadDouble(c0, c1, c2, c3);
+}
+
+inline QuadDouble operator+ (double a, QuadDouble const& b) {
+	return b + a;
+}
+
+inline QuadDouble operator- (QuadDouble const& a) {
+	return QuadDouble(-a[0], -a[1], -a[2], -a[3]);
+}
+
+inline QuadDouble operator- (QuadDouble const& a, QuadDouble const& b) {
+	return a + (-b);
+}
+
+inline QuadDouble operator- (QuadDouble const& a, double b) {
+	return a + (-b);
+}
+
+inline QuadDouble operator- (double a, QuadDouble const& b) {
+	return (-b) + a;
+}
+
+inline QuadDouble operator* (QuadDouble const& a, QuadDouble const& b) {
+	//all products of order up to 2^(-3*53) are accumulated, the higher ones are neglected
+	double p0, p1, p2, p3, p4, p5;
+	double q0, q1, q2, q3, q4, q5;
+	double t0, t1;
+	double s0, s1, s2;
+
+	p0 = detail::two_prod(a[0], b[0], q0);
+
+	p1 = detail::two_prod(a[0], b[1], q1);
+	p2 = detail::two_prod(a[1], b[0], q2);
+
+	p3 = detail::two_prod(a[0], b[2], q3);
+	p4 = detail::two_prod(a[1], b[1], q4);
+	p5 = detail::two_prod(a[2], b[0], q5);
+
+	detail::three_sum(p1, p2, q0);
+
+	detail::three_sum(p2, q1, q2);
+	detail::three_sum(p3, p4, p5);
+	s0 = detail::two_sum(p2, p3, t0);
+	s1 = detail::two_sum(q1, p4, t1);
+	s2 = q2 + p5;
+	s1 = detail::two_sum(s1, t0, t0);
+	s2 += (t0 + t1);
+
+	s1 += a[0]*b[3] + a[1]*b[2] + a[2]*b[1] + a[3]*b[0] + q0 + q3 + q4 + q5;
+	detail::renormalize(p0, p1, s0, s1, s2);
+	return QuadDouble(p0, p1, s0, s1);
+}
+
+inline QuadDouble operator* (QuadDouble const& a, double b) {
+	double p0, p1, p2, p3;
+	double q0, q1, q2;
+	double s0, s1, s2, s3, s4;
+
+	p0 = detail::two_prod(a[0], b, q0);
+	p1 = detail::two_prod(a[1], b, q1);
+	p2 = detail::two_prod(a[2], b, q2);
+	p3 = a[3] * b;
+
+	s0 = p0;
+
+	s1 = detail::two_sum(q0, p1, s2);
+
+	detail::three_sum(s2, q1, p2);
+
+	detail::three_sum2(q1, q2, p3);
+	s3 = q1;
+
+	s4 = q2 + p2;
+
+	detail::renormalize(s0, s1, s2, s3, s4);
+	return QuadDouble(s0, s1, s2, s3);
+}
+
+inline QuadDouble operator* (double a, QuadDouble const& b) {
+	return b * a;
+}
+
+inline QuadDouble operator/ (QuadDouble const& a, QuadDouble const& b) {
+	//long division with five quotient terms
+	double q0, q1, q2, q3, q4;
+
+	q0 = a[0] / b[0];
+	QuadDouble r = a - b * q0;
+
+	q1 = r[0] / b[0];
+	r = r - b * q1;
+
+	q2 = r[0] / b[0];
+	r = r - b * q2;
+
+	q3 = r[0] / b[0];
+	r = r - b * q3;
+
+	q4 = r[0] / b[0];
+
+	detail::renormalize(q0, q1, q2, q3, q4);
+	return QuadDouble(q0, q1, q2, q3);
+}
+
+inline QuadDouble operator/ (QuadDouble const& a, double b) {
+	return a / QuadDouble(b);
+}
+
+inline QuadDouble & QuadDouble::operator+= (QuadDouble const& b) {
+	*this = *this + b;
+	return *this;
+}
+
+inline QuadDouble & QuadDouble::operator-= (QuadDouble const& b) {
+	*this = *this - b;
+	return *this;
+}
+
+inline QuadDouble & QuadDouble::operator*= (QuadDouble const& b) {
+	*this = *this * b;
+	return *this;
+}
+
+inline QuadDouble & QuadDouble::operator/= (QuadDouble const& b) {
+	*this = *this / b;
+	return *this;
+}
+
+inline QuadDouble sqrt(QuadDouble const& a) {
+	if ( a[0] <= 0.0 )
+		return ( a[0] == 0.0 ? QuadDouble(0.0) : QuadDouble(std::numeric_limits<double>::quiet_NaN()) );
+
+	//each Newton step x += x(1/2 - a/2 x^2) for 1/sqrt(a) doubles the number of correct digits
+	QuadDouble x = 1.0 / std::sqrt(a[0]);
+	QuadDouble halfOfA = a * 0.5;
+	for ( size_t i = 0 ; i < 3; ++i)
+		x += x * (0.5 - halfOfA * (x * x));
+	return a * x;
+}
+
+} /* namespace extended_precision */
+} /* namespace gslpp */
+
+#ifdef __FAST_MATH__
+#pragma GCC pop_options
+#endif
+
+namespace gslpp {
+namespace extended_precision {
+
+inline bool operator== (QuadDouble const& a, QuadDouble const& b) {
+	return (a[0] == b[0]) and (a[1] == b[1]) and (a[2] == b[2]) and (a[3] == b[3]);
+}
+
+inline bool operator!= (QuadDouble const& a, QuadDouble const& b) {
+	return not (a == b);
+}
+
+inline bool operator< (QuadDouble const& a, QuadDouble const& b) {
+	for ( size_t i = 0 ; i < 4; ++i)
+		if ( a[i] != b[i] )
+			return a[i] < b[i];
+	return false;
+}
+
+inline bool operator> (QuadDouble const& a, QuadDouble const& b) {
+	return b < a;
+}
+
+inline bool operator<= (QuadDouble const& a, QuadDouble const& b) {
+	return not (b < a);
+}
+
+inline bool operator>= (QuadDouble const& a, QuadDouble const& b) {
+	return not (a < b);
+}
+
+inline QuadDouble fabs(QuadDouble const& a) {
+	return ( a[0] < 0.0 ? -a : a );
+}
+
+inline QuadDouble abs(QuadDouble const& a) {
+	return fabs(a);
+}
+
+inline std::ostream & operator<< (std::ostream & out, QuadDouble const& a) {
+	return detail::write_decimal<QuadDouble,64>(out,a);
+}
+
+} /* namespace extended_precision */
+
+namespace float_comparison {
+
+/// @cond Doxygen_suppress
+template<>
+struct is_NaN_impl< extended_precision::QuadDouble > {
+	static bool is_NaN_call( extended_precision::QuadDouble a ) {
+		return is_NaN<double>( a[0] ) or is_NaN<double>( a[1] ) or is_NaN<double>( a[2] ) or is_NaN<double>( a[3] );
+	};
+};
+
+template<>
+struct equal_up_to_significant_digits_binary_impl< extended_precision::QuadDouble > {
+	static bool equal_up_to_significant_digits_binary_call(
+			extended_precision::QuadDouble a, extended_precision::QuadDouble b, int significantDigits) {
+		return extended_precision::detail::equal_up_to_significant_digits_binary<
+				extended_precision::QuadDouble,211>(a,b,significantDigits);
+	};
+};
+
+template<>
+struct equal_up_to_significant_digits_decimal_impl< extended_precision::QuadDouble > {
+	static bool equal_up_to_significant_digits_decimal_call(
+			extended_precision::QuadDouble a, extended_precision::QuadDouble b, int significantDigits) {
+		const int significantDigitsBase2 = std::ceil(significantDigits/0.3010299957);
+		return equal_up_to_significant_digits_binary(a,b,211+1-significantDigitsBase2);
+	};
+};
+
+template<>
+struct equal_up_to_significant_digits_decimal_above_threshold_impl< extended_precision::QuadDouble > {
+	static bool equal_up_to_significant_digits_decimal_above_threshold_call(
+			extended_precision::QuadDouble a, extended_precision::QuadDouble b,
+			int significantDigits, extended_precision::QuadDouble threshold){
+		if ( (fabs( b ) < threshold) and (fabs(a ) < threshold) )
+			return true;
+		return equal_up_to_significant_digits_decimal(a,b,significantDigits);
+	}
+};
+/// @endcond
+
+} /* namespace float_comparison */
+} /* namespace gslpp */
@@ -0,0 +1,35 @@
+/*
+ * Test.cpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/extended_precision/test/Test.h"
+#include "gslpp/extended_precision/DoubleDouble.h"
+#include "gslpp/extended_precision/QuadDouble.h"
+#include <iostream>
+
+namespace gslpp {
+namespace extended_precision {
+
+void RunTest::run_test(){
+	_allSuccess = true;
+	std::cout << "\n\nStarting tests of the extended_precision namespace" <<std::endl;
+
+	const DoubleDouble piDD(3.141592653589793, 1.2246467991473532e-16);
+	const DoubleDouble sqrtOfTwoDD(1.4142135623730951, -9.667293313452913e-17);
+	test_arithmetic<DoubleDouble>(piDD,sqrtOfTwoDD,30);
+	test_integration<DoubleDouble>(piDD,27);
+
+	const QuadDouble piQD(3.141592653589793, 1.2246467991473532e-16, -2.9947698097183397e-33, 1.1124542208633653e-49);
+	const QuadDouble sqrtOfTwoQD(1.4142135623730951, -9.667293313452913e-17, 4.1386753086994136e-33, 4.935546991468351e-50);
+	test_arithmetic<QuadDouble>(piQD,sqrtOfTwoQD,62);
+	test_integration<QuadDouble>(piQD,55);
+
+	if ( _allSuccess )
+		std::cout << "\nTest of the extended_precision namespace successfull!" << std::endl;
+};
+
+} /* namespace extended_precision */
+} /* namespace gslpp */
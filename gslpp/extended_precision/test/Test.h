@@ -0,0 +1,32 @@
+/*
+ * Test.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_EXTENDED_PRECISION_TEST_H_
+#define GSLPP_EXTENDED_PRECISION_TEST_H_
+
+#include "gslpp/test_common/TestCommon.h"
+
+namespace gslpp {
+namespace extended_precision {
+
+class RunTest : public gslpp::test_common::TestCommon {
+public:
+	void run_test();
+private:
+
+	template<typename T>
+	void test_arithmetic(T const& pi, T const& sqrtOfTwo, int numDigits);
+
+	template<typename T>
+	void test_integration(T const& pi, int numDigits);
+};
+
+} /* namespace extended_precision */
+} /* namespace gslpp */
+
+#include "gslpp/extended_precision/test/Test.hpp"
+#endif /* GSLPP_EXTENDED_PRECISION_TEST_H_ */
@@ -0,0 +1,65 @@
+/*
+ * Test.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/extended_precision/test/Test.h"
+#include "gslpp/integration/Integrator.h"
+#include "gslpp/auxillary/NumAccuracyControl.h"
+#include "gslpp/float_comparison/FloatComparison.h"
+#include <iostream>
+
+namespace gslpp {
+namespace extended_precision {
+
+template<typename T>
+void RunTest::test_arithmetic(T const& pi, T const& sqrtOfTwo, int numDigits){
+	std::cout << "\n\tTest of the arithmetic for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	//a tiny number that is lost in double precision must survive the addition and subtraction of 1
+	const T tiny = T(1e-20);
+	if ( not ( ((T(1.0) + tiny) - 1.0) == tiny ) ) {
+		std::cout << "\n\tTest of the arithmetic for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" (1 + 1e-20) - 1 = "<< ((T(1.0) + tiny) - 1.0) << std::endl;
+		_allSuccess = false;
+	}
+
+	T root = sqrt(T(2.0));
+	if ( not float_comparison::equal_up_to_significant_digits_decimal(root,sqrtOfTwo,numDigits)
+			or not float_comparison::equal_up_to_significant_digits_decimal(root*root,T(2.0),numDigits) ) {
+		std::cout << "\n\tTest of the arithmetic for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" sqrt(2) = "<< root << std::endl;
+		_allSuccess = false;
+	}
+
+	T quotient = (pi / T(7.0)) * T(7.0);
+	if ( not float_comparison::equal_up_to_significant_digits_decimal(quotient,pi,numDigits)
+			or float_comparison::equal_up_to_significant_digits_decimal(pi+pi*T(1e-20),pi,numDigits) ) {
+		std::cout << "\n\tTest of the arithmetic for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" (pi / 7) * 7 = "<< quotient << std::endl;
+		_allSuccess = false;
+	}
+}
+
+template<typename T>
+void RunTest::test_integration(T const& pi, int numDigits){
+	std::cout << "\n\tTest of the integration for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	auto piFunctor = []( T x ){
+		return T(4.0) / ( T(1.0) + x*x );
+	};
+	integration::Integrator< decltype( piFunctor ) > integrator;
+	auxillary::NumAccuracyControl<T> errEstim;
+	T integral;
+	integrator.integrate(T(0.0),T(1.0),piFunctor,integral,errEstim);
+	if ( not float_comparison::equal_up_to_significant_digits_decimal(integral,pi,numDigits) ) {
+		std::cout << "\n\tTest of the integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral "<< integral << " instead of " << pi << std::endl;
+		_allSuccess = false;
+	}
+}
+
+} /* namespace extended_precision */
+} /* namespace gslpp */
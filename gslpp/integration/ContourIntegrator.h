@@ -0,0 +1,136 @@
+/*
+ * ContourIntegrator.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_INTEGRATION_CONTOURINTEGRATOR_H_
+#define GSLPP_INTEGRATION_CONTOURINTEGRATOR_H_
+
+#include "gslpp/integration/Integrator.h"
+#include "gslpp/auxillary/NumAccuracyControl.h"
+#include "gslpp/auxillary/FunctionTraits.h"
+#include <vector>
+#include <complex>
+#include <functional>
+#include <type_traits>
+
+namespace gslpp {
+namespace integration {
+
+/**
+ * 	A class that computes contour integrals \f$\int_C f(z)\rm{d}z\f$ in the complex plane.
+ *
+ * 	The contour is a chain of segments which can be straight lines, circular arcs or user defined
+ * 	parametrized paths. Each segment is mapped onto a unit interval of a real path parameter and all
+ * 	segments are refined together by an adaptive Integrator, using the segment borders as breakpoints.
+ * 	The points on all segments of a refinement loop are thus passed in a single call to
+ * 	evaluate_several_points(std::vector<argument_type> const&, std::vector<result_type>&), if the Function implements it.
+ *
+ * 	The Function takes a single argument of type std::complex<T>. The result is a complex number or a
+ * 	container of complex numbers, which is multiplied by the derivative of the path.
+ */
+template<class Function>
+class ContourIntegrator {
+public:
+
+	/**	we deduce the result type from the Function */
+	typedef typename gslpp::auxillary::FunctionTraits<Function>::result_type result_type;
+
+	/**	we deduce the complex argument type from the Function */
+	typedef typename std::decay<
+			typename gslpp::auxillary::FunctionTraits<Function>::template arg<0>::type >::type argument_type;
+
+	/**	The real type of the path parameter and of the components of argument_type */
+	typedef typename argument_type::value_type real_type;
+
+	/**
+	 * Append a straight line from z0 to z1 to the contour.
+	 *
+	 * @param z0 The start point.
+	 * @param z1 The end point.
+	 */
+	void add_line(argument_type z0, argument_type z1);
+
+	/**
+	 * Append the straight lines between consecutive vertices to the contour.
+	 *
+	 * @param vertices The vertices of the polyline in the order of integration.
+	 */
+	void add_polyline(std::vector<argument_type> const& vertices);
+
+	/**
+	 * Append a circular arc \f$z(\phi) = center + radius\,e^{i\phi}\f$ to the contour.
+	 *
+	 * @param center The center of the circle.
+	 * @param radius The radius of the circle.
+	 * @param phiStart The angle where the arc starts.
+	 * @param phiEnd The angle where the arc ends. The arc is clockwise if phiEnd < phiStart.
+	 */
+	void add_arc(argument_type center, real_type radius, real_type phiStart, real_type phiEnd);
+
+	/**
+	 * Append a user parametrized path to the contour.
+	 *
+	 * @param path The function \f$z(t)\f$. Must be safe to call concurrently if the Function is used from several threads.
+	 * @param derivative Its derivative \f$\rm{d}z/\rm{d}t\f$.
+	 * @param tStart The parameter where the path starts.
+	 * @param tEnd The parameter where the path ends.
+	 */
+	void add_path(std::function<argument_type(real_type)> const& path,
+			std::function<argument_type(real_type)> const& derivative,
+			real_type tStart, real_type tEnd);
+
+	/**
+	 * Remove all segments of the contour.
+	 */
+	void clear_contour();
+
+	/**	@return The number of segments of the contour */
+	size_t num_segments() const;
+
+	/**
+	 * Compute the contour integral.
+	 *
+	 * The accuracy goals and the budget of integralAcc apply to the sum over all segments.
+	 *
+	 * @param f The function to be integrated.
+	 * @param integral The approximate integral \f$\int_C f(z)\rm{d}z\f$. For container types,
+	 * 			the shape on input defines the shape of the result.
+	 * @param integralAcc The accuracy and budget control. On output it contains the absolute error estimate.
+	 */
+	void integrate(Function const &f,
+			result_type &integral,
+			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
+private:
+
+	typedef enum {
+		LINE,
+		ARC,
+		PATH
+	} SegmentType;
+
+	typedef struct {
+		SegmentType type;
+		argument_type start;
+		argument_type end;
+		real_type radius;
+		real_type parameterStart;
+		real_type parameterEnd;
+		std::function<argument_type(real_type)> path;
+		std::function<argument_type(real_type)> derivative;
+	} Segment;
+
+	class PathFunction;
+
+	std::vector<Segment> _segments;
+
+	void point_on_contour(real_type s, argument_type &z, argument_type &dzds) const;
+};
+
+} /* namespace integration */
+} /* namespace gslpp */
+
+#include "gslpp/integration/src/ContourIntegrator.hpp"
+#endif /* GSLPP_INTEGRATION_CONTOURINTEGRATOR_H_ */
@@ -0,0 +1,134 @@
+/*
+ * GaussQuadratureRule.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_INTEGRATION_GAUSSQUADRATURERULE_H_
+#define GSLPP_INTEGRATION_GAUSSQUADRATURERULE_H_
+
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+
+namespace gslpp {
+namespace integration {
+
+/**
+ * 	The nodes and weights of an n-point Gauss rule of the Legendre, Laguerre or Hermite family.
+ *
+ * 	The rules are
+ * 		- LEGENDRE \f$ \int_{-1}^{1} f(x)\rm{d}x \approx \sum_i w_i f(x_i) \f$
+ * 		- LAGUERRE \f$ \int_{0}^{\infty} e^{-x} f(x)\rm{d}x \approx \sum_i w_i f(x_i) \f$
+ * 		- HERMITE \f$ \int_{-\infty}^{\infty} e^{-x^2} f(x)\rm{d}x \approx \sum_i w_i f(x_i) \f$
+ *
+ * 	The nodes are the roots of the orthogonal polynomial of degree n. They are found in O(n) operations
+ * 	by marching along the differential equation of the polynomial: the solution is expanded in a Taylor
+ * 	series around the current point, whose coefficients follow from the differential equation, and the next
+ * 	root is found by Newton's method on this series (Glaser, Liu and Rokhlin). The step length is a fraction
+ * 	of the local distance of the roots and of the distance to the singular point of the equation, such that
+ * 	no root is skipped. The weights follow from the derivative at the roots and are normalized to the
+ * 	integral of the weight function. The scale of the solution is kept as an exact power of two, and the
+ * 	logarithms of the weights are available, since the weights of large Laguerre and Hermite rules underflow.
+ * 	The distance of the Legendre roots to the end of the interval is marched along with the roots, since a node
+ * 	close to 1 does not resolve 1-x and the weights there are sensitive to it. At \f$10^5\f$ nodes the
+ * 	relative error of the weights is about \f$10^{-10}\f$ at the ends, also with -ffast-math.
+ *
+ * 	A rule with \f$10^5\f$ nodes takes about 0.1 seconds. Use GaussQuadratureRule.cached_rule to
+ * 	share rules across the program, such that the construction is paid only once.
+ */
+template<typename T>
+class GaussQuadratureRule {
+	static_assert(std::is_floating_point<T>::value, "The Gauss rules are computed for floating point types");
+public:
+
+	typedef enum {
+		LEGENDRE,
+		LAGUERRE,
+		HERMITE
+	} Family;
+
+	/**
+	 * Compute the rule. This does not use the cache.
+	 *
+	 * @param family The family of the orthogonal polynomials.
+	 * @param numNodes The number of nodes n. Must be at least 1.
+	 */
+	GaussQuadratureRule(Family family, size_t numNodes);
+
+	/**
+	 * Get a rule from the process wide cache, computing it on first use.
+	 *
+	 * This is thread safe. A rule is computed only once, while other threads that request
+	 * rules wait for the construction to finish.
+	 *
+	 * @param family The family of the orthogonal polynomials.
+	 * @param numNodes The number of nodes n. Must be at least 1.
+	 * @return A shared pointer to the rule which stays valid if the cache is cleared.
+	 */
+	static std::shared_ptr<const GaussQuadratureRule<T> > cached_rule(Family family, size_t numNodes);
+
+	/**
+	 * Remove all rules from the cache. Rules still held by the caller remain valid.
+	 */
+	static void clear_cache();
+
+	/**	@return The family of the rule */
+	Family get_family() const;
+
+	/**	@return The number of nodes of the rule */
+	size_t num_nodes() const;
+
+	/**	@return The nodes in increasing order */
+	std::vector<T> const& get_nodes() const;
+
+	/**	@return The weights in the order of the nodes. Weights below the smallest representable number are zero. */
+	std::vector<T> const& get_weights() const;
+
+	/**	@return The natural logarithms of the weights in the order of the nodes */
+	std::vector<T> const& get_log_weights() const;
+private:
+
+	typedef std::map< std::pair<int,size_t>, std::shared_ptr<const GaussQuadratureRule<T> > > RuleCache;
+
+	Family _family;
+
+	size_t _numNodes;
+
+	std::vector<T> _nodes;
+
+	std::vector<T> _weights;
+
+	std::vector<T> _logWeights;
+
+	static RuleCache & rule_cache();
+
+	static std::mutex & cache_mutex();
+
+	//the distance oneMinusX = 1-x is carried along separately, such that it has a small relative error
+	//	close to the end of the Legendre interval where the weights depend strongly on it.
+	void march_roots(T x, T oneMinusX, T y, T dy, size_t numRoots,
+			std::vector<T> &roots, std::vector<T> &oneMinusRoots, std::vector<T> &logDerivatives) const;
+
+	T step_length(T x, T oneMinusX) const;
+
+	void taylor_coefficients(T x, T oneMinusX, T y, T dy, T step, std::vector<T> &coefficients) const;
+
+	void evaluate_series(std::vector<T> const& coefficients, T step, T t, T &y, T &dy) const;
+
+	void set_weights(std::vector<T> const& logDerivatives, std::vector<T> const& distancesToEnd);
+
+	//the sum of the values in [begin,end) by pairwise summation
+	static T pairwise_sum(T const * begin, T const * end);
+};
+
+} /* namespace integration */
+} /* namespace gslpp */
+
+#include "gslpp/integration/src/GaussQuadratureRule.hpp"
+#endif /* GSLPP_INTEGRATION_GAUSSQUADRATURERULE_H_ */
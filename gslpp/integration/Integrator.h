@@ -12,6 +12,7 @@
 #include "gslpp/auxillary/FunctionTraits.h"
 #include "gslpp/auxillary/defines_value_type.h"
 #include <vector>
+#include <string>
 #include <type_traits>
 
 namespace gslpp {
@@ -35,22 +36,125 @@ public:
 	/**	we deduce the argument i type from the Function */
 	typedef typename gslpp::auxillary::FunctionTraits<Function>::template arg<indexT>::type argument_type;
 
+	/**
+	 * Constructor using the default settings. Speculative evaluation is switched off.
+	 */
+	Integrator();
+
 	/**
 	 * Compute the adaptive integral using the template Function.
 	 *
+	 * The refinement stops if the accuracy goals of integralAcc are met, the maximal number of subdivisions
+	 * is reached or the budget of integralAcc is exhausted. In the latter case, the integral is the best
+	 * current estimate, the error estimate of integralAcc covers the intervals that were about to be subdivided
+	 * and integralAcc.budget_exhausted() returns true.
+	 *
 	 * @param lborder lower integral border.
 	 * @param uborder upper integral border.
-	 * @return The approximate integral \f$\int_{lborder}^{uborder} f(x)\rm{d}x\f$
+	 * @param f The function to be integrated.
+	 * @param integral The approximate integral \f$\int_{lborder}^{uborder} f(x)\rm{d}x\f$
+	 * @param integralAcc The accuracy and budget control. On output it contains the absolute error estimate.
 	 */
 	void integrate(argument_type lborder, argument_type uborder,
 			Function const &f,
 			result_type &integral,
 			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
 
+	/**
+	 * Compute the adaptive integral over consecutive intervals between breakpoints.
+	 *
+	 * The intervals [breakpoints[i],breakpoints[i+1]] are refined together as in Integrator.integrate, such
+	 * that the points of all intervals of a refinement loop are evaluated in one batch and the accuracy
+	 * goals apply to the sum. Known singularities or kinks of f should be placed at breakpoints.
+	 *
+	 * @param breakpoints The ordered borders of the intervals. At least two are needed.
+	 * @param f The function to be integrated.
+	 * @param integral The approximate integral \f$\int_{breakpoints[0]}^{breakpoints[n-1]} f(x)\rm{d}x\f$
+	 * @param integralAcc The accuracy and budget control. On output it contains the absolute error estimate.
+	 */
+	void integrate(std::vector<argument_type> const& breakpoints,
+			Function const &f,
+			result_type &integral,
+			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
+
 	void non_adaptive_integral(std::vector<argument_type> segmentPoints,
 			Function const &f,
 			result_type &integral,
 			result_type &errorEstimation) const;
+
+	/**
+	 * Compute the integral with a fixed n-point Gauss-Legendre rule on each segment.
+	 *
+	 * The rule is taken from the cache of GaussQuadratureRule and computed on first use. All points
+	 * of all segments are evaluated in a single call. No error estimate is available, compare
+	 * two different numbers of nodes if needed.
+	 *
+	 * @param segmentPoints The ordered borders of the segments.
+	 * @param numNodes The number of Gauss nodes per segment.
+	 * @param f The function to be integrated.
+	 * @param integral The approximate integral \f$\int_{segmentPoints[0]}^{segmentPoints[n-1]} f(x)\rm{d}x\f$
+	 */
+	void gauss_legendre_integral(std::vector<argument_type> const& segmentPoints,
+			size_t numNodes,
+			Function const &f,
+			result_type &integral) const;
+
+	/**
+	 * Set the target number of points per call to the function evaluation.
+	 *
+	 * If the Kronrad points of the intervals of an adaptive refinement loop in Integrator.integrate
+	 * do not fill a batch of this size, the points of the subintervals of the intervals with the
+	 * largest error estimate are evaluated speculatively one level ahead in the same call.
+	 * These values are cached and used in the next loop if the interval is subdivided.
+	 * This reduces the number of calls to the function evaluation which is beneficial for
+	 * functions with a large overhead per call of evaluate_several_points.
+	 *
+	 * @param numPoints The target number of points per batch. Zero switches the speculation off.
+	 */
+	void set_speculative_batch_width(size_t numPoints);
+
+	/**
+	 * Set a file where Integrator.integrate stores the state of the adaptive refinement.
+	 *
+	 * The state consists of the accepted intervals, the intervals that remain to be evaluated including
+	 * the state of the breakpoint detection, and the counters of evaluations and refinement loops. It is written every loopsBetweenCheckpoints loops
+	 * and when the budget of the accuracy control is exhausted. Use Integrator.resume_integration
+	 * to continue the refinement without redoing finished intervals.
+	 * The file is written in the native byte order and is only readable with the same types.
+	 *
+	 * @param fileName The name of the checkpoint file. An empty name switches checkpointing off.
+	 * @param loopsBetweenCheckpoints The number of refinement loops between two checkpoints.
+	 * 			Zero writes a checkpoint only when the budget is exhausted.
+	 */
+	void set_checkpoint_file(std::string const& fileName, size_t loopsBetweenCheckpoints);
+
+	/**
+	 * Continue an adaptive integration from a checkpoint file.
+	 *
+	 * @param fileName The name of the checkpoint file written by Integrator.integrate.
+	 * @param f The function to be integrated. Must be the same as in the run that wrote the file.
+	 * @param integral The approximate integral. For types with an iterator, the shape on input
+	 * 			must be the same as in the run that wrote the file.
+	 * @param integralAcc The accuracy and budget control. On output it contains the absolute error estimate.
+	 */
+	void resume_integration(std::string const& fileName,
+			Function const &f,
+			result_type &integral,
+			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
+
+	/**
+	 * Switch the detection of jumps and kinks in Integrator.integrate on or off.
+	 *
+	 * An interval is suspicious if the error estimate did not drop by at least a factor 16 in two
+	 * consecutive bisections, as is the case for a jump or a kink of the integrand. Instead of bisecting it
+	 * further, the location of the jump or kink is bracketed by sampling the function on 9 equidistant
+	 * points and narrowing to the segment where the first (jump) or second (kink) differences dominate.
+	 * The bracket is inserted as a breakpoint such that the smooth remainder converges right away.
+	 * The samples of all suspicious intervals of a loop are evaluated in one batch and count in the budget.
+	 *
+	 * @param detect True switches the detection on. The default is off.
+	 */
+	void set_breakpoint_detection(bool detect);
 private:
 
 	//The following construct identifies weight_type as the type specified by result_type::value_type
@@ -67,20 +171,97 @@ private:
 		result_type integralVal;
 		result_type errEstim;
 		size_t subdiv;
+		size_t numStalledSubdiv;
 	} Interval;
 
+	typedef struct {
+		std::vector<Interval> intervals;
+		std::vector<Interval> intervalsToBeDone;
+		size_t numEvaluations;
+		size_t numLoops;
+	} AdaptiveState;
+
+	typedef struct {
+		argument_type lborder;
+		argument_type uborder;
+		std::vector<result_type> valAtKronradPoints;
+		size_t age;
+	} SpeculativeInterval;
+
 	typedef struct {
 		weight_type operator() (weight_type estimate1,weight_type estimate2) const {
-			return std::pow(200.0*std::fabs(estimate1-estimate2),1.5);
+			//the math functions are found by argument dependent lookup for types outside of std::
+			using std::fabs;
+			using std::sqrt;
+			weight_type scaledDifference = fabs(estimate1-estimate2)*weight_type(200);
+			return scaledDifference*sqrt(scaledDifference);
 		}
 	} ErrorEstimationFunctor;
 
 	ErrorEstimationFunctor _errorEstimationFunctor;
 
+	typedef struct {
+		weight_type operator() (weight_type value1,weight_type value2) const {
+			using std::fabs;
+			return fabs(value1-value2);
+		}
+	} AbsoluteDifferenceFunctor;
+
+	typedef struct {
+		argument_type lborder;
+		argument_type uborder;
+		std::vector<result_type> valAtSamples;
+		result_type errEstim;
+		size_t subdiv;
+		bool found;
+		bool active;
+	} BreakpointBracket;
+
 	mutable result_type _zeroOfResultType;
 
+	size_t _speculativeBatchWidth;
+
+	size_t _maxAgeSpeculativeInterval;
+
+	std::string _checkpointFileName;
+
+	size_t _loopsBetweenCheckpoints;
+
+	bool _detectBreakpoints;
+
+	void refine(AdaptiveState &state,
+			Function const &f,
+			result_type &integral,
+			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
+
+	void write_checkpoint(std::string const& fileName, AdaptiveState const& state) const;
+
+	void read_checkpoint(std::string const& fileName, AdaptiveState & state) const;
+
+	void locate_breakpoints(std::vector<Interval> const& suspiciousIntervals,
+			Function const &f,
+			gslpp::auxillary::NumAccuracyControl<result_type> const& integralAcc,
+			std::vector<Interval> &intervalsNextLoop,
+			size_t &numEvaluations) const;
+
+	argument_type sample_point(argument_type lborder, argument_type uborder, size_t i, size_t numSegments) const;
+
+	void absolute_difference(result_type const & value1, result_type const & value2, result_type & difference) const;
+
 	void add_interval_points(argument_type lborder,argument_type uborder,std::vector<argument_type> &points) const;
 
+	void split_interval(Interval const& interval, Interval &intervalLower, Interval &intervalUpper) const;
+
+	size_t find_speculative_interval(std::vector<SpeculativeInterval> const& speculativeIntervals,
+			argument_type lborder, argument_type uborder) const;
+
+	void evaluate_intervals(std::vector<Interval> const& intervalsToBeDone,
+			Function const &f,
+			gslpp::auxillary::NumAccuracyControl<result_type> const& integralAcc,
+			std::vector<SpeculativeInterval> &speculativeIntervals,
+			std::vector<result_type> &valAtPoints,
+			size_t &numEvaluations) const;
+
 	void evaluate_integral_formula_for_interval(
 			size_t indexOfIntervalInData,
 			weight_type intervalLength,
@@ -92,10 +273,16 @@ private:
 
 	weight_type gauss_kronrad_err_est(weight_type estimGauss, weight_type estimKronrad) const;
 
-	void get_kronrad_points(argument_type lborder,argument_type uborder, argument_type (&kronradPoints)[15] ) const;
+	//the nodes and weights are stored as sums of four doubles, such that they are exact
+	//	to the precision of weight_type up to 4*53 bits.
+	struct GaussKronradConstants {
+		GaussKronradConstants();
+		weight_type kronradNodes[15];
+		weight_type kronradWeights[15];
+		weight_type gaussWeights[7];
+	};
 
-	void get_kronrad_weights(weight_type (&kronradWeights)[15] ) const;
-	void get_gauss_weights(weight_type (&gaussWeights)[7] ) const;
+	static GaussKronradConstants const& gauss_kronrad_constants();
 
 	void evaluate_several_points(std::vector<argument_type> const &points,
 			Function const &f,
@@ -103,7 +290,14 @@ private:
 
 	void set_to_zero(result_type &toBeSetZero) const;
 
-	result_type evaluate_error(result_type const & estimate1, result_type const & estimate2) const;
+	//target += value, target += value*factor and target *= factor without temporaries for container types
+	void add_to(result_type &target, result_type const& value) const;
+
+	void add_scaled_to(result_type &target, result_type const& value, weight_type factor) const;
+
+	void scale(result_type &target, weight_type factor) const;
+
+	void evaluate_error(result_type const & estimate1, result_type const & estimate2, result_type & error) const;
 };
 
 } /* namespace integration */
@@ -0,0 +1,121 @@
+/*
+ * IteratedIntegrator.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_INTEGRATION_ITERATEDINTEGRATOR_H_
+#define GSLPP_INTEGRATION_ITERATEDINTEGRATOR_H_
+
+#include "gslpp/integration/Integrator.h"
+#include "gslpp/auxillary/NumAccuracyControl.h"
+#include "gslpp/auxillary/FunctionTraits.h"
+#include "gslpp/auxillary/index_sequence.h"
+#include <vector>
+#include <tuple>
+#include <type_traits>
+
+namespace gslpp {
+namespace integration {
+
+/**
+ * 	A class that computes iterated integrals over several arguments of a multi-argument function.
+ *
+ * 	The integral \f$\int_{l_0}^{u_0}\rm{d}x_0 \int_{l_1}^{u_1}\rm{d}x_1 \dots f(x_0,x_1,\dots)\f$ is computed
+ * 	by nesting adaptive Integrator objects, where the arguments are listed outermost first in the template
+ * 	parameters indices. Arguments of the Function that are not listed are kept fixed.
+ * 	In each refinement loop the outermost Integrator evaluates all its points in a single call,
+ * 	which computes the set of inner integrals in parallel threads. Each thread integrates
+ * 	its share of points with its own Integrator objects such that no state is shared between threads.
+ */
+template<class Function, size_t ... indices>
+class IteratedIntegrator {
+public:
+
+	/**	we deduce the result type from the Function */
+	typedef typename gslpp::auxillary::FunctionTraits<Function>::result_type result_type;
+
+	/**	The number of nested integrals */
+	static const size_t numLevels = sizeof...(indices);
+
+	static_assert(numLevels > 0, "At least one argument must be integrated!" );
+private:
+	typedef gslpp::auxillary::index_sequence<indices...> integration_indices;
+
+	typedef typename gslpp::auxillary::make_index_sequence<
+			gslpp::auxillary::FunctionTraits<Function>::nargs>::type all_argument_indices;
+
+	template<class Sequence>
+	struct argument_tuple_trait;
+public:
+
+	/**	A tuple with the values of all arguments of the Function */
+	typedef typename argument_tuple_trait<all_argument_indices>::type argument_tuple;
+
+	/**
+	 * Constructor using the default settings. The number of threads is the number of hardware threads.
+	 */
+	IteratedIntegrator();
+
+	/**
+	 * Set the number of threads that compute the inner integrals of an outer refinement loop.
+	 *
+	 * @param numThreads The number of threads. One computes all integrals in the calling thread.
+	 */
+	void set_num_threads(size_t numThreads);
+
+	/**
+	 * Set the accuracy control of an inner integral.
+	 *
+	 * Each inner integral uses a copy of this object, thus its budget applies to every single inner integral.
+	 * The default uses gslpp::auxillary::AccuracyGoal<result_type>. The thresholds should be tighter
+	 * than those of the outer integral, since the error of the inner integrals enters the outer integrand.
+	 *
+	 * @param level The nesting level of the integral, 1 for the integral directly inside the outermost.
+	 * 			Must be > 0 and < numLevels.
+	 * @param levelAcc The accuracy control used for all integrals of this level.
+	 */
+	void set_accuracy_control(size_t level, gslpp::auxillary::NumAccuracyControl<result_type> const& levelAcc);
+
+	/**
+	 * Compute the iterated integral.
+	 *
+	 * The elements of lborders and uborders for the integrated arguments are the integral borders.
+	 * The elements of lborders for the other arguments are the fixed values passed to the Function.
+	 *
+	 * @param lborders lower integral borders and values of the fixed arguments.
+	 * @param uborders upper integral borders. The elements of the fixed arguments are ignored.
+	 * @param f The function to be integrated. Must be safe to call concurrently from several threads.
+	 * @param integral The approximate iterated integral.
+	 * @param integralAcc The accuracy and budget control of the outermost integral. On output
+	 * 			it contains the absolute error estimate of the outermost integral.
+	 */
+	void integrate(argument_tuple const& lborders, argument_tuple const& uborders,
+			Function const &f,
+			result_type &integral,
+			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
+private:
+
+	template<size_t level, bool isInnermost = (level+1 == numLevels)>
+	class LevelFunction;
+
+	size_t _numThreads;
+
+	std::vector< gslpp::auxillary::NumAccuracyControl<result_type> > _levelAcc;
+
+	template<size_t level>
+	void evaluate_inner_integrals(LevelFunction<level,false> const& levelFunction,
+			std::vector<typename LevelFunction<level,false>::argument_type> const &points,
+			std::vector<result_type> &setOfEvaluatedPoints) const;
+
+	template<size_t ... i>
+	static result_type call_function(Function const &f, argument_tuple const& point,
+			gslpp::auxillary::index_sequence<i...>);
+};
+
+} /* namespace integration */
+} /* namespace gslpp */
+
+#include "gslpp/integration/src/IteratedIntegrator.hpp"
+#endif /* GSLPP_INTEGRATION_ITERATEDINTEGRATOR_H_ */
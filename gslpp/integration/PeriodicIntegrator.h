@@ -0,0 +1,149 @@
+/*
+ * PeriodicIntegrator.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_INTEGRATION_PERIODICINTEGRATOR_H_
+#define GSLPP_INTEGRATION_PERIODICINTEGRATOR_H_
+
+#include "gslpp/auxillary/NumAccuracyControl.h"
+#include "gslpp/auxillary/FunctionTraits.h"
+#include "gslpp/auxillary/defines_value_type.h"
+#include <vector>
+#include <complex>
+#include <cmath>
+
+namespace gslpp {
+namespace integration {
+
+/**
+ * 	A class that integrates a smooth periodic function over one full period.
+ *
+ * 	For such functions, the trapezoidal rule on equidistant points converges exponentially.
+ * 	The number of points is doubled until the accuracy goals are met, reusing all previous points.
+ * 	The points of each doubling are evaluated in a single call to evaluate_several_points, if
+ * 	the Function implements it.
+ *
+ * 	Separate integrators can be used concurrently from several threads. The plans of the Fourier
+ * 	transform are created and destroyed under a lock, since this modifies global state of FFTW.
+ */
+template<class Function, size_t indexT=0>
+class PeriodicIntegrator {
+public:
+
+	/**	we deduce the result type from the Function */
+	typedef typename gslpp::auxillary::FunctionTraits<Function>::result_type result_type;
+
+	static_assert(indexT < gslpp::auxillary::FunctionTraits<Function>::nargs,
+			"Second template parameter must be < the number of arguments to the operator()!" );
+
+	/**	we deduce the argument i type from the Function */
+	typedef typename gslpp::auxillary::FunctionTraits<Function>::template arg<indexT>::type argument_type;
+
+private:
+	//The following construct identifies weight_type as the type specified by result_type::value_type
+	//	or result_type itself if no such type exists.
+	template<	typename T,
+				bool hasIterator = auxillary::defines_value_type<T>::value
+			>struct result_type_trait;
+public:
+
+	/**	The type of the numbers that multiply the result_type */
+	typedef typename result_type_trait<result_type>::value_type weight_type;
+
+	/**
+	 * Constructor using the default settings of 8 initial and at most 2^20 points.
+	 */
+	PeriodicIntegrator();
+
+	/**
+	 * Set the number of points of the first trapezoidal approximation.
+	 *
+	 * Features of the function that are not resolved by these points can go unnoticed if
+	 * the first doubling happens to give the same estimate.
+	 *
+	 * @param numSamples The initial number of points. Must be at least 1.
+	 */
+	void set_initial_num_samples(size_t numSamples);
+
+	/**
+	 * Set the maximal number of points after which the doubling stops.
+	 *
+	 * @param numSamples The maximal number of points.
+	 */
+	void set_max_num_samples(size_t numSamples);
+
+	/**
+	 * Compute the integral of a periodic function over one period.
+	 *
+	 * The doubling stops if integralAcc.global_sufficient is met for the difference of the last
+	 * two approximations, the number of doublings exceeds the maximal subdivisions of integralAcc, the
+	 * maximal number of points is reached or the budget of integralAcc is exhausted.
+	 *
+	 * @param lborder lower integral border.
+	 * @param uborder upper integral border. uborder-lborder must be the period of f.
+	 * @param f The function to be integrated.
+	 * @param integral The approximate integral \f$\int_{lborder}^{uborder} f(x)\rm{d}x\f$
+	 * @param integralAcc The accuracy and budget control. On output it contains the absolute error estimate.
+	 */
+	void integrate(argument_type lborder, argument_type uborder,
+			Function const &f,
+			result_type &integral,
+			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
+
+	/**
+	 * Compute the Fourier coefficients of a periodic function from the converged set of points.
+	 *
+	 * The coefficients are \f$c_k = \frac{1}{N}\sum_{j=0}^{N-1} f(x_j) e^{-2\pi i jk/N}\f$ with
+	 * \f$x_j = lborder + j (uborder-lborder)/N\f$ such that \f$ f(x)=\sum_k c_k e^{2\pi i k (x-lborder)/(uborder-lborder)}\f$.
+	 * For a real function, only the N/2+1 coefficients with \f$k\geq 0\f$ are returned, for a complex function
+	 * all N coefficients where the index k>N/2 corresponds to the negative frequency k-N.
+	 * The number of points N is determined as in PeriodicIntegrator.integrate, such that \f$c_0\f$ times the
+	 * period meets the accuracy goal. Use PeriodicIntegrator.set_initial_num_samples to resolve a given
+	 * number of coefficients. The transform uses FFTW and is available for double and std::complex<double>.
+	 *
+	 * @param lborder lower border of the period.
+	 * @param uborder upper border of the period.
+	 * @param f The periodic function.
+	 * @param coefficients On output, the Fourier coefficients.
+	 * @param integralAcc The accuracy and budget control. On output it contains the absolute error estimate of the integral.
+	 */
+	void fourier_coefficients(argument_type lborder, argument_type uborder,
+			Function const &f,
+			std::vector< std::complex<weight_type> > &coefficients,
+			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
+private:
+
+	size_t _initialNumSamples;
+
+	size_t _maxNumSamples;
+
+	typedef struct {
+		weight_type operator() (weight_type value1,weight_type value2) const {
+			using std::fabs;
+			return fabs(value1-value2);
+		}
+	} AbsoluteDifferenceFunctor;
+
+	void trapezoidal_doubling(argument_type lborder, argument_type uborder,
+			Function const &f,
+			std::vector<result_type> &valAtPoints,
+			result_type &integral,
+			gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const;
+
+	argument_type sample_point(argument_type lborder, argument_type uborder, size_t i, size_t numSegments) const;
+
+	void evaluate_several_points(std::vector<argument_type> const &points,
+			Function const &f,
+			std::vector<result_type> &setOfEvaluatedPoints) const;
+
+	result_type absolute_difference(result_type const & value1, result_type const & value2) const;
+};
+
+} /* namespace integration */
+} /* namespace gslpp */
+
+#include "gslpp/integration/src/PeriodicIntegrator.hpp"
+#endif /* GSLPP_INTEGRATION_PERIODICINTEGRATOR_H_ */
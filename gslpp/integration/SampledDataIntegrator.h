@@ -0,0 +1,155 @@
+/*
+ * SampledDataIntegrator.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_INTEGRATION_SAMPLEDDATAINTEGRATOR_H_
+#define GSLPP_INTEGRATION_SAMPLEDDATAINTEGRATOR_H_
+
+#include <vector>
+#include <cstddef>
+
+namespace gslpp {
+namespace integration {
+
+/**
+ * 	A class that integrates sampled data \f$ f_i = f(x_i) \f$ on uniform or non-uniform abscissae.
+ *
+ * 	The rules are
+ * 		- TRAPEZOID the integral of the linear interpolation, exact for linear data.
+ * 		- SIMPSON the integral of a parabola through consecutive pairs of intervals, exact for quadratic data.
+ * 			If the number of intervals is odd, the last interval uses the parabola through the last three samples.
+ * 		- CUBIC the integral of the cubic through the two samples on either side of each interval, exact for
+ * 			cubic data. The first and last interval use the cubic through the first and last four samples.
+ *
+ * 	The data is passed in chunks of any size, such that arrays that do not fit into memory can be
+ * 	integrated in a single pass, e.g. from a gslpp::auxillary::MappedArray. Only the last few samples
+ * 	of a chunk are kept for the stencils that cross into the next one. Large chunks are split into contiguous
+ * 	ranges that are summed by several threads. Each range is summed pairwise with independent partial sums
+ * 	in the innermost blocks that vectorize, which keeps the rounding error at \f$ O(\log N) \f$.
+ * 	The result does not depend on how the data is split into chunks, up to this rounding.
+ */
+template<typename T>
+class SampledDataIntegrator {
+public:
+
+	typedef enum {
+		TRAPEZOID = 0,
+		SIMPSON = 1,
+		CUBIC = 2
+	} Rule;
+
+	/**
+	 * Constructor using as many threads as there are cores.
+	 *
+	 * @param rule The integration rule.
+	 */
+	explicit SampledDataIntegrator(Rule rule = TRAPEZOID);
+
+	/**
+	 * Set the number of threads that sum the ranges of a large chunk.
+	 *
+	 * @param numThreads The number of threads. Zero is taken as one.
+	 */
+	void set_num_threads(size_t numThreads);
+
+	/**
+	 * Start a new integral over samples with a constant distance.
+	 *
+	 * @param spacing The distance \f$ x_{i+1}-x_i \f$ of the samples.
+	 */
+	void begin_uniform(T spacing);
+
+	/**
+	 * Start a new integral over samples with individual abscissae.
+	 */
+	void begin_nonuniform();
+
+	/**
+	 * Add the next chunk of samples of a uniform integral.
+	 *
+	 * @param values The samples \f$ f_i \f$.
+	 * @param numSamples The number of samples in the chunk.
+	 */
+	void push(T const * values, size_t numSamples);
+
+	/**
+	 * Add the next chunk of samples of a non-uniform integral.
+	 *
+	 * @param abscissae The strictly increasing abscissae \f$ x_i \f$.
+	 * @param values The samples \f$ f_i \f$.
+	 * @param numSamples The number of samples in the chunk.
+	 */
+	void push(T const * abscissae, T const * values, size_t numSamples);
+
+	/**
+	 * Finish the integral by the intervals at the end of the data.
+	 *
+	 * @return The integral over all samples that have been pushed since the last begin.
+	 */
+	T finish();
+
+	/**	@return The number of samples that have been pushed since the last begin */
+	size_t num_samples() const;
+
+	/**
+	 * Integrate an array of samples with a constant distance in a single chunk.
+	 *
+	 * @param values The samples.
+	 * @param numSamples The number of samples.
+	 * @param spacing The distance of the samples.
+	 * @return The integral.
+	 */
+	T integrate_uniform(T const * values, size_t numSamples, T spacing);
+
+	/**
+	 * Integrate an array of samples with individual abscissae in a single chunk.
+	 *
+	 * @param abscissae The strictly increasing abscissae.
+	 * @param values The samples.
+	 * @param numSamples The number of samples.
+	 * @return The integral.
+	 */
+	T integrate(T const * abscissae, T const * values, size_t numSamples);
+private:
+
+	Rule _rule;
+
+	size_t _numThreads;
+
+	bool _streamActive;
+
+	bool _uniform;
+
+	T _spacing;
+
+	size_t _numSamples;
+
+	size_t _nextUnit;
+
+	T _sum;
+
+	size_t _bufferStart;
+
+	std::vector<T> _bufferAbscissae;
+
+	std::vector<T> _bufferValues;
+
+	void push_samples(T const * abscissae, T const * values, size_t numSamples);
+
+	size_t first_sample_of_unit(size_t unit) const;
+
+	size_t num_complete_units(size_t numSamples) const;
+
+	T sum_units(T const * abscissae, T const * values, size_t base, size_t unitBegin, size_t unitEnd) const;
+
+	T tail_contribution() const;
+};
+
+} /* namespace integration */
+} /* namespace gslpp */
+
+#include "gslpp/integration/src/SampledDataIntegrator.hpp"
+#endif /* GSLPP_INTEGRATION_SAMPLEDDATAINTEGRATOR_H_ */
@@ -0,0 +1,103 @@
+/*
+ * SplineMomentIntegrator.h
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#ifndef GSLPP_INTEGRATION_SPLINEMOMENTINTEGRATOR_H_
+#define GSLPP_INTEGRATION_SPLINEMOMENTINTEGRATOR_H_
+
+#include "gslpp/auxillary/FunctionTraits.h"
+#include <vector>
+#include <complex>
+#include <cstddef>
+
+namespace gslpp {
+namespace integration {
+
+/**
+ * 	A class that integrates a cubic spline against a weight function exactly, segment by segment.
+ *
+ * 	The spline is written as \f$ s(x) = \sum_{k=0}^{3} c_k t^k \f$ on each segment \f$[x_0,x_0+h]\f$ with
+ * 	\f$ t = (x-x_0)/h \f$, such that \f$ \int w(x)s(x)\rm{d}x \f$ is a sum over the analytic moments
+ * 	\f$ h\int_0^1 w(x_0+ht)t^k\rm{d}t \f$ of the weight (Filon's method). In contrast to a quadrature,
+ * 	this is exact for oscillatory weights irrespective of the frequency.
+ *
+ * 	The Spline must provide num_polynomials() and get_polynomial(i) with polynomials that provide
+ * 	min_range(), interval_length() and power_basis_coefficients(), such as CubeSpline and MonotoneCubeHermiteSpline.
+ * 	The coefficients are copied on construction, later changes of the spline are not seen.
+ */
+template<class Spline>
+class SplineMomentIntegrator {
+public:
+
+	/**	we deduce the real type from the Spline */
+	typedef typename gslpp::auxillary::FunctionTraits<Spline>::result_type real_type;
+
+	/**
+	 * Copy the power basis coefficients of all segments of the spline.
+	 *
+	 * @param spline An initialized spline.
+	 */
+	explicit SplineMomentIntegrator(Spline const& spline);
+
+	/**
+	 * @return The integral \f$ \int s(x)\rm{d}x \f$ over the range of definition of the spline.
+	 */
+	real_type integral() const;
+
+	/**
+	 * Compute \f$ \int e^{i\omega x}s(x)\rm{d}x \f$ over the range of definition for many frequencies at once.
+	 *
+	 * The frequencies are processed in blocks of 8, which form the inner loop over small local arrays.
+	 * The phase \f$ e^{i\omega x_0} \f$ is advanced from one segment to the next by a multiplication
+	 * and recomputed every 128 segments. The moments of the exponential are computed only if the length
+	 * of a segment differs from the previous one by more than the rounding of the grid points, which
+	 * makes equidistant grids particularly fast.
+	 * For \f$ |\omega h| < 1 \f$ the moments are evaluated by their power series to avoid cancellations.
+	 *
+	 * @param omegas The frequencies \f$ \omega \f$.
+	 * @param integrals On output, the integrals in the order of omegas.
+	 */
+	void fourier_integrals(std::vector<real_type> const& omegas,
+			std::vector< std::complex<real_type> > &integrals) const;
+
+	/**
+	 * Compute the power moments \f$ \int x^n s(x)\rm{d}x \f$ for \f$ n=0 \dots maxPower \f$.
+	 *
+	 * The moments of each segment are expanded in \f$ x_0^{n-j}h^j \f$ which can lose digits
+	 * for large maxPower on grids that contain the origin.
+	 *
+	 * @param maxPower The largest power n.
+	 * @param moments On output, the moments in the order of increasing n.
+	 */
+	void power_moments(size_t maxPower, std::vector<real_type> &moments) const;
+
+	/**
+	 * Compute \f$ \int w(x)s(x)\rm{d}x \f$ for a weight with user supplied moments, e.g. a Bessel function.
+	 *
+	 * The KernelMoments object is called for every segment as kernelMoments(x0,h,moments) and must set
+	 * moments[k] to \f$ h\int_0^1 w(x_0+ht)t^k\rm{d}t \f$ for k=0..3.
+	 *
+	 * @param kernelMoments The functor that computes the moments of the weight.
+	 * @return The integral.
+	 */
+	template<typename result_type, class KernelMoments>
+	result_type weighted_integral(KernelMoments const& kernelMoments) const;
+private:
+
+	std::vector<real_type> _segmentStart;
+
+	std::vector<real_type> _segmentLength;
+
+	std::vector<real_type> _coefficients[4];
+
+	void unit_fourier_moments(real_type theta, std::complex<real_type> (&moments)[4]) const;
+};
+
+} /* namespace integration */
+} /* namespace gslpp */
+
+#include "gslpp/integration/src/SplineMomentIntegrator.hpp"
+#endif /* GSLPP_INTEGRATION_SPLINEMOMENTINTEGRATOR_H_ */
@@ -0,0 +1,168 @@
+/*
+ * ContourIntegrator.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/integration/ContourIntegrator.h"
+#include "gslpp/auxillary/has_function_signature.h"
+#include "gslpp/auxillary/has_iterator.h"
+#include "gslpp/error_handling/Error.h"
+#include <cmath>
+#include <algorithm>
+
+namespace gslpp {
+namespace integration {
+
+template<class Function>
+void ContourIntegrator<Function>::add_line(argument_type z0, argument_type z1) {
+	Segment segment = Segment();
+	segment.type = LINE;
+	segment.start = z0;
+	segment.end = z1;
+	_segments.push_back(segment);
+}
+
+template<class Function>
+void ContourIntegrator<Function>::add_polyline(std::vector<argument_type> const& vertices) {
+	for ( size_t i = 0 ; i+1 < vertices.size(); ++i)
+		this->add_line(vertices[i],vertices[i+1]);
+}
+
+template<class Function>
+void ContourIntegrator<Function>::add_arc(argument_type center, real_type radius,
+		real_type phiStart, real_type phiEnd) {
+	Segment segment = Segment();
+	segment.type = ARC;
+	segment.start = center;
+	segment.radius = radius;
+	segment.parameterStart = phiStart;
+	segment.parameterEnd = phiEnd;
+	_segments.push_back(segment);
+}
+
+template<class Function>
+void ContourIntegrator<Function>::add_path(std::function<argument_type(real_type)> const& path,
+		std::function<argument_type(real_type)> const& derivative,
+		real_type tStart, real_type tEnd) {
+	Segment segment = Segment();
+	segment.type = PATH;
+	segment.parameterStart = tStart;
+	segment.parameterEnd = tEnd;
+	segment.path = path;
+	segment.derivative = derivative;
+	_segments.push_back(segment);
+}
+
+template<class Function>
+void ContourIntegrator<Function>::clear_contour() {
+	_segments.clear();
+}
+
+template<class Function>
+size_t ContourIntegrator<Function>::num_segments() const {
+	return _segments.size();
+}
+
+//Segment number k of the contour is mapped onto the interval [k,k+1] of the path parameter s.
+template<class Function>
+void ContourIntegrator<Function>::point_on_contour(real_type s, argument_type &z, argument_type &dzds) const {
+	const size_t k = std::min(static_cast<size_t>(std::max(s,real_type(0))),_segments.size()-1);
+	const real_type t = s - static_cast<real_type>(k);
+	Segment const& segment = _segments[k];
+	switch ( segment.type ) {
+	case LINE :
+		dzds = segment.end - segment.start;
+		z = segment.start + dzds*t;
+		break;
+	case ARC : {
+		const real_type deltaPhi = segment.parameterEnd - segment.parameterStart;
+		const argument_type direction = std::polar(segment.radius,segment.parameterStart + deltaPhi*t);
+		z = segment.start + direction;
+		dzds = argument_type(0,deltaPhi)*direction;
+		break;
+	}
+	case PATH : {
+		const real_type deltaT = segment.parameterEnd - segment.parameterStart;
+		const real_type tPath = segment.parameterStart + deltaT*t;
+		z = segment.path(tPath);
+		dzds = segment.derivative(tPath)*deltaT;
+		break;
+	}
+	}
+}
+
+//We delegate the multiplication of the result with the derivative of the path
+//	to an element wise version if the result type has an iterator.
+namespace delegate{
+template <typename T, typename complexT, bool THasIterator = auxillary::has_iterator<T>::value>
+struct multiply_by_complex_impl { };
+
+template <typename T, typename complexT>
+struct multiply_by_complex_impl<T,complexT,false> {
+	static void call (T & value, complexT const& factor) {value = value*factor;};
+};
+
+template <typename T, typename complexT>
+struct multiply_by_complex_impl<T,complexT,true> {
+	static void call (T & value, complexT const& factor) {
+		for ( auto &&element : value)
+			element = element*factor;
+	};
+};
+}; /* namespace delegate */
+
+//The integrand along the real path parameter s: f(z(s)) dz/ds
+template<class Function>
+class ContourIntegrator<Function>::PathFunction {
+public:
+	PathFunction(ContourIntegrator const& contour, Function const &f) : _contour(contour), _f(f) { };
+
+	result_type operator() (real_type s) const {
+		std::vector<real_type> points(1,s);
+		std::vector<result_type> values;
+		this->evaluate_several_points(points,values);
+		return values.front();
+	}
+
+	void evaluate_several_points(std::vector<real_type> const &points,
+			std::vector<result_type> &setOfEvaluatedPoints) const {
+		std::vector<argument_type> pointsOnContour(points.size());
+		std::vector<argument_type> derivatives(points.size());
+		for ( size_t i = 0 ; i < points.size(); ++i)
+			_contour.point_on_contour(points[i],pointsOnContour[i],derivatives[i]);
+
+		//the points of all segments are passed to the Function at once
+		delegate::evaluate_several_points_impl<Function,result_type,argument_type,
+			gslpp::auxillary::has_evaluate_several_points<Function const,
+				void(std::vector<argument_type> const&, std::vector<result_type>&) >::value
+			>::call(pointsOnContour,_f,setOfEvaluatedPoints);
+
+		for ( size_t i = 0 ; i < points.size(); ++i)
+			delegate::multiply_by_complex_impl<result_type,argument_type>::call(setOfEvaluatedPoints[i],derivatives[i]);
+	}
+private:
+	ContourIntegrator const& _contour;
+
+	Function const &_f;
+};
+
+template<class Function>
+void ContourIntegrator<Function>::integrate(Function const &f,
+		result_type &integral,
+		gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+	if ( _segments.empty() )
+		gslpp::error_handling::Error( "The contour has no segments",gslpp::error_handling::Error::INPUT_ERROR);
+
+	std::vector<real_type> breakpoints(_segments.size()+1);
+	for ( size_t k = 0 ; k < breakpoints.size(); ++k)
+		breakpoints[k] = static_cast<real_type>(k);
+
+	PathFunction pathFunction(*this,f);
+	Integrator<PathFunction> integrator;
+	integrator.integrate(breakpoints,pathFunction,integral,integralAcc);
+}
+
+} /* namespace integration */
+} /* namespace gslpp */
@@ -0,0 +1,321 @@
+/*
+ * GaussQuadratureRule.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/integration/GaussQuadratureRule.h"
+#include "gslpp/error_handling/Error.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace gslpp {
+namespace integration {
+
+template<typename T>
+GaussQuadratureRule<T>::GaussQuadratureRule(Family family, size_t numNodes) :
+	_family(family), _numNodes(numNodes) {
+	if ( numNodes == 0 )
+		gslpp::error_handling::Error( "A Gauss rule needs at least one node",gslpp::error_handling::Error::INPUT_ERROR);
+
+	std::vector<T> roots, oneMinusRoots, logDerivatives;
+	roots.reserve(numNodes);
+	oneMinusRoots.reserve(numNodes);
+	logDerivatives.reserve(numNodes);
+	if ( family == LAGUERRE ) {
+		//L_n(0) = 1 and L_n'(0) = -n
+		this->march_roots(T(0),T(1),T(1),-static_cast<T>(numNodes),numNodes,roots,oneMinusRoots,logDerivatives);
+		_nodes = roots;
+		this->set_weights(logDerivatives,oneMinusRoots);
+		return;
+	}
+
+	//Legendre and Hermite polynomials are symmetric, we march from the origin to the positive roots.
+	const size_t numPositiveRoots = numNodes/2;
+	if ( numNodes % 2 == 1 ) {
+		roots.push_back(T(0));
+		oneMinusRoots.push_back(T(1));
+		logDerivatives.push_back(T(0));
+		this->march_roots(T(0),T(1),T(0),T(1),numPositiveRoots+1,roots,oneMinusRoots,logDerivatives);
+	} else {
+		this->march_roots(T(0),T(1),T(1),T(0),numPositiveRoots,roots,oneMinusRoots,logDerivatives);
+	}
+
+	//the distance to the nearer end of the interval is the same for both roots of a symmetric pair
+	_nodes.resize(numNodes);
+	std::vector<T> orderedLogDerivatives(numNodes);
+	std::vector<T> distancesToEnd(numNodes);
+	for ( size_t i = 0 ; i < roots.size(); ++i) {
+		_nodes[numNodes-roots.size()+i] = roots[i];
+		_nodes[roots.size()-1-i] = -roots[i];
+		orderedLogDerivatives[numNodes-roots.size()+i] = logDerivatives[i];
+		orderedLogDerivatives[roots.size()-1-i] = logDerivatives[i];
+		distancesToEnd[numNodes-roots.size()+i] = oneMinusRoots[i];
+		distancesToEnd[roots.size()-1-i] = oneMinusRoots[i];
+	}
+	this->set_weights(orderedLogDerivatives,distancesToEnd);
+}
+
+template<typename T>
+typename GaussQuadratureRule<T>::RuleCache & GaussQuadratureRule<T>::rule_cache() {
+	static RuleCache cache;
+	return cache;
+}
+
+template<typename T>
+std::mutex & GaussQuadratureRule<T>::cache_mutex() {
+	static std::mutex mutex;
+	return mutex;
+}
+
+template<typename T>
+std::shared_ptr<const GaussQuadratureRule<T> >
+GaussQuadratureRule<T>::cached_rule(Family family, size_t numNodes) {
+	std::lock_guard<std::mutex> lock(cache_mutex());
+	const std::pair<int,size_t> key(static_cast<int>(family),numNodes);
+	typename RuleCache::iterator it = rule_cache().find(key);
+	if ( it != rule_cache().end() )
+		return it->second;
+	std::shared_ptr<const GaussQuadratureRule<T> > rule =
+			std::make_shared<const GaussQuadratureRule<T> >(family,numNodes);
+	rule_cache()[key] = rule;
+	return rule;
+}
+
+template<typename T>
+void GaussQuadratureRule<T>::clear_cache() {
+	std::lock_guard<std::mutex> lock(cache_mutex());
+	rule_cache().clear();
+}
+
+template<typename T>
+typename GaussQuadratureRule<T>::Family GaussQuadratureRule<T>::get_family() const {
+	return _family;
+}
+
+template<typename T>
+size_t GaussQuadratureRule<T>::num_nodes() const {
+	return _numNodes;
+}
+
+template<typename T>
+std::vector<T> const& GaussQuadratureRule<T>::get_nodes() const {
+	return _nodes;
+}
+
+template<typename T>
+std::vector<T> const& GaussQuadratureRule<T>::get_weights() const {
+	return _weights;
+}
+
+template<typename T>
+std::vector<T> const& GaussQuadratureRule<T>::get_log_weights() const {
+	return _logWeights;
+}
+
+//The step is a quarter of the local distance of the roots from the WKB approximation of the
+//	differential equation and at most half the distance to a singular point, where the Taylor series
+//	would converge slowly.
+template<typename T>
+T GaussQuadratureRule<T>::step_length(T x, T oneMinusX) const {
+	const T pi = std::acos(T(-1));
+	const T n = static_cast<T>(_numNodes);
+	switch ( _family ) {
+	case LEGENDRE : {
+		const T rootDistance = pi*std::sqrt(oneMinusX*(T(1)+x))/(n+T(0.5));
+		return std::min(T(0.25)*rootDistance,T(0.5)*oneMinusX);
+	}
+	case LAGUERRE : {
+		if ( x == T(0) )
+			return T(1)/(T(4)*n+T(2));
+		//beyond the turning point at 4n+2 the roots are separated by about (4n+2)^(1/3)
+		const T waveNumberSquared = std::max((n+T(0.5))/x - T(0.25),std::pow(T(4)*n+T(2),-T(2)/T(3)));
+		return std::min(T(0.25)*pi/std::sqrt(waveNumberSquared),T(0.5)*x);
+	}
+	case HERMITE : {
+		const T waveNumberSquared = std::max(T(2)*n+T(1)-x*x,std::pow(T(2)*n+T(1),T(1)/T(3)));
+		return T(0.25)*pi/std::sqrt(waveNumberSquared);
+	}
+	}
+	return T(0);
+}
+
+//The coefficients b_m = y^(m)(x) step^m / m! follow from differentiating the
+//	differential equation m times:
+//	Legendre (1-x^2) y'' - 2x y' + n(n+1) y = 0
+//	Laguerre x y'' + (1-x) y' + n y = 0
+//	Hermite y'' - 2x y' + 2n y = 0
+template<typename T>
+void GaussQuadratureRule<T>::taylor_coefficients(T x, T oneMinusX, T y, T dy, T step,
+		std::vector<T> &coefficients) const {
+	const size_t maxNumCoefficients = 1000;
+	const T tolerance = std::numeric_limits<T>::epsilon()*T(0.01);
+	const T n = static_cast<T>(_numNodes);
+	coefficients.clear();
+	coefficients.push_back(y);
+	coefficients.push_back(dy*step);
+	T largest = std::max(std::fabs(coefficients[0]),std::fabs(coefficients[1]));
+	for ( size_t m = 0 ; m+2 < maxNumCoefficients; ++m) {
+		const T mr = static_cast<T>(m);
+		T next = 0;
+		switch ( _family ) {
+		case LEGENDRE :
+			next = ( T(2)*(mr+T(1))*(mr+T(1))*x*step*coefficients[m+1]
+					+ (mr*(mr+T(1)) - n*(n+T(1)))*step*step*coefficients[m] )
+					/ (oneMinusX*(T(1)+x)*(mr+T(2))*(mr+T(1)));
+			break;
+		case LAGUERRE :
+			if ( x == T(0) ) {
+				//at the singular point only the polynomial solution exists and b_{m+1} follows from b_m alone
+				next = (mr+T(1)-n)*step*coefficients[m+1]/((mr+T(2))*(mr+T(2)));
+			} else {
+				next = ( (x-T(1)-mr)*(mr+T(1))*step*coefficients[m+1] + (mr-n)*step*step*coefficients[m] )
+						/ (x*(mr+T(2))*(mr+T(1)));
+			}
+			break;
+		case HERMITE :
+			next = ( T(2)*x*(mr+T(1))*step*coefficients[m+1] + T(2)*(mr-n)*step*step*coefficients[m] )
+					/ ((mr+T(2))*(mr+T(1)));
+			break;
+		}
+		coefficients.push_back(next);
+		largest = std::max(largest,std::fabs(next));
+		if ( (std::fabs(next) <= tolerance*largest) and (std::fabs(coefficients[m+1]) <= tolerance*largest) )
+			return;
+	}
+	gslpp::error_handling::Error( "The Taylor series of the orthogonal polynomial did not converge",
+			gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+}
+
+template<typename T>
+void GaussQuadratureRule<T>::evaluate_series(std::vector<T> const& coefficients, T step, T t, T &y, T &dy) const {
+	y = coefficients.back();
+	dy = 0;
+	for ( size_t m = coefficients.size()-1 ; m > 0; --m) {
+		dy = dy*t + y;
+		y = y*t + coefficients[m-1];
+	}
+	dy /= step;
+}
+
+template<typename T>
+void GaussQuadratureRule<T>::march_roots(T x, T oneMinusX, T y, T dy, size_t numRoots,
+		std::vector<T> &roots, std::vector<T> &oneMinusRoots, std::vector<T> &logDerivatives) const {
+	const T log2 = std::log(T(2));
+	const size_t maxNumSteps = 100*_numNodes+1000;
+	//the solution is y*2^exponent, which keeps y and dy in range with exact rescaling
+	long exponent = 0;
+	std::vector<T> coefficients;
+	for ( size_t stepNumber = 0 ; roots.size() < numRoots; ++stepNumber) {
+		if ( stepNumber == maxNumSteps )
+			gslpp::error_handling::Error( "The roots of the orthogonal polynomial were not found",
+					gslpp::error_handling::Error::INTERNAL_LOGIC_CHECK_FAILED);
+
+		const T step = this->step_length(x,oneMinusX);
+		this->taylor_coefficients(x,oneMinusX,y,dy,step,coefficients);
+		T yEnd, dyEnd;
+		this->evaluate_series(coefficients,step,T(1),yEnd,dyEnd);
+
+		//at a root, the sign right after it is the sign of the derivative
+		const bool startPositive = ( y != T(0) ? y > T(0) : dy > T(0) );
+		if ( (yEnd != T(0)) and ((yEnd > T(0)) == startPositive) ) {
+			x = x + step;
+			oneMinusX = oneMinusX - step;
+			int e;
+			std::frexp(std::max(std::fabs(yEnd),std::fabs(dyEnd)*step),&e);
+			y = std::ldexp(yEnd,-e);
+			dy = std::ldexp(dyEnd,-e);
+			exponent += e;
+			continue;
+		}
+
+		//Newton's method on the series, safeguarded by bisection of the bracket
+		T lower = 0, upper = 1, t = 1, yt = yEnd, dyt = dyEnd;
+		for ( size_t iteration = 0 ; iteration < 200; ++iteration) {
+			if ( yt == T(0) )
+				break;
+			if ( (yt > T(0)) == startPositive )
+				lower = t;
+			else
+				upper = t;
+			T tNew = t - yt/(dyt*step);
+			if ( not ((tNew > lower) and (tNew < upper)) )
+				tNew = (lower+upper)*T(0.5);
+			const bool converged = std::fabs(tNew-t) <= T(4)*std::numeric_limits<T>::epsilon()*t;
+			t = tNew;
+			this->evaluate_series(coefficients,step,t,yt,dyt);
+			if ( converged or (upper-lower <= T(4)*std::numeric_limits<T>::epsilon()*t) )
+				break;
+		}
+
+		x = x + t*step;
+		oneMinusX = oneMinusX - t*step;
+		roots.push_back(x);
+		oneMinusRoots.push_back(oneMinusX);
+		logDerivatives.push_back(std::log(std::fabs(dyt)) + static_cast<T>(exponent)*log2);
+		int e;
+		std::frexp(dyt,&e);
+		y = 0;
+		dy = std::ldexp(dyt,-e);
+		exponent += e;
+	}
+}
+
+//The weights in terms of the derivative of the polynomial at the roots are
+//	Legendre 2/((1-x^2) P_n'(x)^2), Laguerre 1/(x L_n'(x)^2) and Hermite 2^(n+1) n! sqrt(pi)/H_n'(x)^2.
+//	Since the polynomials are known up to a factor, the weights are normalized to the integral of the weight function.
+template<typename T>
+void GaussQuadratureRule<T>::set_weights(std::vector<T> const& logDerivatives, std::vector<T> const& distancesToEnd) {
+	_logWeights.resize(_numNodes);
+	T logTotalWeight = 0;
+	for ( size_t i = 0 ; i < _numNodes; ++i) {
+		const T x = _nodes[i];
+		switch ( _family ) {
+		case LEGENDRE :
+			//1-x^2 = d (2-d) with the distance d to the nearer end
+			_logWeights[i] = - std::log(distancesToEnd[i]) - std::log(T(2)-distancesToEnd[i]) - T(2)*logDerivatives[i];
+			logTotalWeight = std::log(T(2));
+			break;
+		case LAGUERRE :
+			_logWeights[i] = - std::log(x) - T(2)*logDerivatives[i];
+			logTotalWeight = T(0);
+			break;
+		case HERMITE :
+			_logWeights[i] = - T(2)*logDerivatives[i];
+			logTotalWeight = T(0.5)*std::log(std::acos(T(-1)));
+			break;
+		}
+	}
+
+	const T largest = *std::max_element(_logWeights.begin(),_logWeights.end());
+	std::vector<T> terms(_numNodes);
+	for ( size_t i = 0 ; i < _numNodes; ++i)
+		terms[i] = std::exp(_logWeights[i]-largest);
+	const T sum = pairwise_sum(terms.data(),terms.data()+_numNodes);
+	const T shift = logTotalWeight - largest - std::log(sum);
+	_weights.resize(_numNodes);
+	for ( size_t i = 0 ; i < _numNodes; ++i) {
+		_logWeights[i] += shift;
+		_weights[i] = std::exp(_logWeights[i]);
+	}
+}
+
+//Unlike a compensated sum, the error bound of O(log(n) epsilon) does not rely on the exact order of
+//	the floating point operations and thus also holds with -ffast-math.
+template<typename T>
+T GaussQuadratureRule<T>::pairwise_sum(T const * begin, T const * end) {
+	const size_t numValues = end - begin;
+	if ( numValues <= 16 ) {
+		T sum = 0;
+		for ( T const * it = begin ; it != end; ++it)
+			sum += *it;
+		return sum;
+	}
+	T const * middle = begin + numValues/2;
+	return pairwise_sum(begin,middle) + pairwise_sum(middle,end);
+}
+
+} /* namespace integration */
+} /* namespace gslpp */
@@ -6,57 +6,138 @@
  */
 
 #include "gslpp/integration/Integrator.h"
+#include "gslpp/integration/GaussQuadratureRule.h"
 #include "gslpp/auxillary/has_function_signature.h"
 #include "gslpp/auxillary/has_iterator.h"
+#include "gslpp/error_handling/Error.h"
 #include <cmath>
 #include <type_traits>
 #include <complex>
+#include <algorithm>
+#include <fstream>
+#include <cstdio>
+#include <stdint.h>
+#include <string>
 
 namespace gslpp {
 namespace integration {
 
+template<class Function,size_t indexT>
+Integrator<Function,indexT>::Integrator() : _speculativeBatchWidth(0), _maxAgeSpeculativeInterval(8),
+	_loopsBetweenCheckpoints(0), _detectBreakpoints(false) {
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::set_speculative_batch_width(size_t numPoints) {
+	_speculativeBatchWidth = numPoints;
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::set_checkpoint_file(std::string const& fileName, size_t loopsBetweenCheckpoints) {
+	_checkpointFileName = fileName;
+	_loopsBetweenCheckpoints = loopsBetweenCheckpoints;
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::set_breakpoint_detection(bool detect) {
+	_detectBreakpoints = detect;
+}
+
 template<class Function,size_t indexT>
 void Integrator<Function,indexT>::integrate(
 		argument_type lborder, argument_type uborder,
 		Function const &f,
 		result_type &integral,
 		auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+	this->integrate(std::vector<argument_type>{lborder,uborder},f,integral,integralAcc);
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::integrate(
+		std::vector<argument_type> const& breakpoints,
+		Function const &f,
+		result_type &integral,
+		auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+	if ( breakpoints.size() < 2 )
+		gslpp::error_handling::Error( "At least two breakpoints are needed to define an integral, got "
+				+std::to_string(breakpoints.size()),gslpp::error_handling::Error::INPUT_ERROR);
 
 	//set integral and error estimates to zero
 	this->set_to_zero(integral);
 	_zeroOfResultType = integral;
+
+	//set up the initial intervals between the breakpoints. They are all evaluated in the first loop.
+	Integrator::AdaptiveState state;
+	state.intervalsToBeDone.reserve( breakpoints.size()-1 );
+	for ( size_t i = 0 ; i+1 < breakpoints.size(); ++i) {
+		Integrator::Interval interval;
+		interval.errEstim = _zeroOfResultType;
+		interval.integralVal = _zeroOfResultType;
+		interval.lborder = breakpoints[i];
+		interval.uborder = breakpoints[i+1];
+		interval.subdiv = 0;
+		interval.numStalledSubdiv = 0;
+		state.intervalsToBeDone.push_back( interval );
+	}
+	state.numEvaluations = 0;
+	state.numLoops = 0;
+
+	this->refine(state,f,integral,integralAcc);
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::resume_integration(std::string const& fileName,
+		Function const &f,
+		result_type &integral,
+		auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+
+	//the shape of the integral defines the shape of all values in the checkpoint
+	this->set_to_zero(integral);
+	_zeroOfResultType = integral;
+
+	Integrator::AdaptiveState state;
+	this->read_checkpoint(fileName,state);
+
+	this->refine(state,f,integral,integralAcc);
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::refine(AdaptiveState &state,
+		Function const &f,
+		result_type &integral,
+		auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+
 	result_type errEstim(_zeroOfResultType);
 
 	bool converged;
 
-	//set up the first initial interval
-	Integrator::Interval interval;
-	interval.errEstim = _zeroOfResultType;
-	interval.integralVal = _zeroOfResultType;
-	interval.lborder = lborder;
-	interval.uborder = uborder;
-	interval.subdiv = 0;
-	typename std::vector<Integrator::Interval> intervalsToBeDone( 1, interval );
+	typename std::vector<Integrator::Interval> &intervalsToBeDone = state.intervalsToBeDone;
 	typename std::vector<Integrator::Interval> intervalsToBeDoneNextLoop;
 
-	std::vector<argument_type> points;
+	//subintervals that have been evaluated ahead of time in the last loop
+	std::vector<Integrator::SpeculativeInterval> speculativeIntervals;
 
 	//a collection of intervals that meet at least the local error bounds.
-	std::vector<Integrator::Interval> intervals;
+	std::vector<Integrator::Interval> &intervals = state.intervals;
+
+	//the contributions of intervals that are subdivided in a loop and replaced by subintervals in the next one
+	result_type integralSubdivided(_zeroOfResultType);
+	result_type errEstimSubdivided(_zeroOfResultType);
+
+	size_t &numEvaluations = state.numEvaluations;
+	integralAcc.set_budget_exhausted(false);
+
+	//intervals where the error does not drop upon bisection
+	std::vector<Integrator::Interval> suspiciousIntervals;
 
 	do {
 		converged = true;
-
-		//collect all points that need to be evaluated
-		typename std::vector<Integrator::Interval>::iterator it;
-		for (  it = intervalsToBeDone.begin() ;it != intervalsToBeDone.end(); ++it)
-			this->add_interval_points(it->lborder,it->uborder,points);
+		this->set_to_zero(integralSubdivided);
+		this->set_to_zero(errEstimSubdivided);
 
 		//evaluate all points
 		std::vector<result_type> valAtPoints;
-		valAtPoints.reserve(points.size());
-		this->evaluate_several_points(points,f,valAtPoints);
-		points.clear();
+		this->evaluate_intervals(intervalsToBeDone,f,integralAcc,speculativeIntervals,valAtPoints,numEvaluations);
 
 		//evaluate the integral and set up intervals for the next loop
 		for ( size_t i = 0 ; i < intervalsToBeDone.size(); i++) {
@@ -72,15 +153,30 @@ void Integrator<Function,indexT>::integrate(
 			//split all intervals in two for the next loop that are not locally converged sufficiently.
 			if ( (not thisIntervalConverged) and
 				 (integralAcc.sub_divisions_below_max(intervalsToBeDone[i].subdiv)) ){
-				argument_type middle =  ( intervalsToBeDone[i].uborder + intervalsToBeDone[i].lborder )
-						* weight_type(0.5);
-				intervalsToBeDone[i].subdiv += 1;
-				Integrator::Interval intervalLower = intervalsToBeDone[i];
-				Integrator::Interval intervalUpper = intervalsToBeDone[i];
-				intervalLower.uborder = middle;
-				intervalUpper.lborder = middle;
-				intervalsToBeDoneNextLoop.push_back(intervalLower);
-				intervalsToBeDoneNextLoop.push_back(intervalUpper);
+				this->add_to(integralSubdivided,localContribution);
+				this->add_to(errEstimSubdivided,localErrEstim);
+
+				//the error of a smooth function drops by orders of magnitude upon bisection
+				//	while it drops by a factor 2^(-1.5) for a jump and 2^(-3) for a kink.
+				if ( _detectBreakpoints ) {
+					if ( (intervalsToBeDone[i].subdiv > 0) and integralAcc.first_lower_than_second(
+							intervalsToBeDone[i].errEstim*static_cast<weight_type>(1.0/16.0),localErrEstim) )
+						intervalsToBeDone[i].numStalledSubdiv += 1;
+					else
+						intervalsToBeDone[i].numStalledSubdiv = 0;
+				}
+
+				//the subintervals inherit the error estimate which ranks them for speculative evaluation
+				intervalsToBeDone[i].errEstim = localErrEstim;
+				intervalsToBeDone[i].integralVal = localContribution;
+				if ( intervalsToBeDone[i].numStalledSubdiv >= 2 ) {
+					suspiciousIntervals.push_back(intervalsToBeDone[i]);
+				} else {
+					Integrator::Interval intervalLower, intervalUpper;
+					this->split_interval(intervalsToBeDone[i],intervalLower,intervalUpper);
+					intervalsToBeDoneNextLoop.push_back(intervalLower);
+					intervalsToBeDoneNextLoop.push_back(intervalUpper);
+				}
 			} else {
 				intervalsToBeDone[i].integralVal = localContribution;
 				intervalsToBeDone[i].errEstim = localErrEstim;
@@ -91,12 +187,17 @@ void Integrator<Function,indexT>::integrate(
 			converged = converged and thisIntervalConverged;
 		}
 
+		if ( not suspiciousIntervals.empty() ) {
+			this->locate_breakpoints(suspiciousIntervals,f,integralAcc,intervalsToBeDoneNextLoop,numEvaluations);
+			suspiciousIntervals.clear();
+		}
+
 		this->set_to_zero(integral);
 		this->set_to_zero(errEstim);
 		for ( auto it = intervals.begin(); it != intervals.end(); ++it )
 		{
-			errEstim = errEstim + it->errEstim;
-			integral = integral + it->integralVal;
+			this->add_to(errEstim,it->errEstim);
+			this->add_to(integral,it->integralVal);
 		}
 
 		//if local convergence has been achieved, check global convergence
@@ -119,34 +220,209 @@ void Integrator<Function,indexT>::integrate(
 				//the interval that should be subdivided is not dividable any more
 				if ( ! integralAcc.sub_divisions_below_max(itMax->subdiv) ){
 					//Warn
+					integralAcc.set_abs_error_estimate(errEstim);
 					return;
 				}
 
-				//remove the intervals contribution as the two subintervals will be re-added
-				//in the next loop
-				this->set_to_zero(itMax->errEstim);
-				this->set_to_zero(itMax->integralVal);
-
 				//add the two intervals to be done in the next loop
-				argument_type middle = ( itMax->lborder + itMax->uborder )*0.5;
-				itMax->subdiv += 1;
-				Integrator::Interval intervalLower = *itMax;
-				Integrator::Interval intervalUpper = *itMax;
-				intervalLower.uborder = middle;
-				intervalUpper.lborder = middle;
+				Integrator::Interval intervalLower, intervalUpper;
+				this->split_interval(*itMax,intervalLower,intervalUpper);
 				intervalsToBeDoneNextLoop.push_back(intervalLower);
 				intervalsToBeDoneNextLoop.push_back(intervalUpper);
+
+				//remove the interval as the two subintervals will be re-added in the next loop.
+				//	Keeping it with a zero contribution would allow to select it again if the error
+				//	comparison is not a total order, e.g. component wise for complex numbers.
+				this->add_to(integralSubdivided,itMax->integralVal);
+				this->add_to(errEstimSubdivided,itMax->errEstim);
+				intervals.erase(itMax);
 			}
 		}
 
 		intervalsToBeDone.clear();
 		intervalsToBeDone.swap(intervalsToBeDoneNextLoop);
+		state.numLoops += 1;
+
+		//if the budget does not allow the next loop, we return the best current estimate. The subdivided
+		//	intervals enter with the estimate from before the subdivision.
+		if ( (not converged) and
+				(not integralAcc.budget_allows(numEvaluations + 15*intervalsToBeDone.size())) ) {
+			integral = integralSubdivided;
+			errEstim = errEstimSubdivided;
+			for ( auto it = intervals.begin(); it != intervals.end(); ++it )
+			{
+				this->add_to(errEstim,it->errEstim);
+				this->add_to(integral,it->integralVal);
+			}
+			integralAcc.set_budget_exhausted(true);
+			if ( not _checkpointFileName.empty() )
+				this->write_checkpoint(_checkpointFileName,state);
+			break;
+		}
+
+		//at this point, the state is complete such that the integration can be resumed from here
+		if ( (not converged) and (not _checkpointFileName.empty()) and (_loopsBetweenCheckpoints > 0)
+				and ( state.numLoops % _loopsBetweenCheckpoints == 0 ) )
+			this->write_checkpoint(_checkpointFileName,state);
 
 	}while ( not converged );
 
 	integralAcc.set_abs_error_estimate(errEstim);
 }
 
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::locate_breakpoints(std::vector<Interval> const& suspiciousIntervals,
+		Function const &f,
+		gslpp::auxillary::NumAccuracyControl<result_type> const& integralAcc,
+		std::vector<Interval> &intervalsNextLoop,
+		size_t &numEvaluations) const {
+	//the brackets are sampled at 9 equidistant points. The segment of a jump (1/8 of the bracket)
+	//	is 3 subdivisions deep, the two segments around a kink (1/4 of the bracket) are 2 subdivisions deep.
+	const size_t numSegments = 8;
+	const weight_type dominance = 4;
+
+	std::vector<Integrator::BreakpointBracket> brackets(suspiciousIntervals.size());
+	for ( size_t i = 0 ; i < suspiciousIntervals.size(); ++i) {
+		brackets[i].lborder = suspiciousIntervals[i].lborder;
+		brackets[i].uborder = suspiciousIntervals[i].uborder;
+		brackets[i].valAtSamples.assign(numSegments+1,_zeroOfResultType);
+		brackets[i].errEstim = suspiciousIntervals[i].errEstim;
+		brackets[i].subdiv = suspiciousIntervals[i].subdiv;
+		brackets[i].found = false;
+		brackets[i].active = true;
+	}
+
+	for ( size_t iteration = 0 ; ; ++iteration ) {
+
+		//collect the sample points of all brackets that are narrowed further. The borders
+		//	of a bracket are sample points of the previous iteration.
+		std::vector<argument_type> points;
+		const size_t firstSample = (iteration == 0 ? 0 : 1);
+		const size_t lastSample = (iteration == 0 ? numSegments : numSegments-1);
+		for ( auto &bracket : brackets ) {
+			if ( bracket.active and (not integralAcc.sub_divisions_below_max(bracket.subdiv+3)) )
+				bracket.active = false;
+			if ( not bracket.active )
+				continue;
+			for ( size_t j = firstSample ; j <= lastSample; ++j)
+				points.push_back(this->sample_point(bracket.lborder,bracket.uborder,j,numSegments));
+		}
+		if ( points.empty() or (not integralAcc.budget_allows(numEvaluations + points.size())) )
+			break;
+
+		std::vector<result_type> valAtPoints;
+		valAtPoints.reserve(points.size());
+		this->evaluate_several_points(points,f,valAtPoints);
+		numEvaluations += points.size();
+
+		size_t indexOfValue = 0;
+		for ( size_t i = 0 ; i < brackets.size(); ++i) {
+			Integrator::BreakpointBracket &bracket = brackets[i];
+			if ( not bracket.active )
+				continue;
+			std::vector<result_type> &val = bracket.valAtSamples;
+			for ( size_t j = firstSample ; j <= lastSample; ++j)
+				val[j] = valAtPoints[indexOfValue++];
+
+			//a jump is in the segment where the first difference dominates all others
+			std::vector<result_type> diff(numSegments,_zeroOfResultType);
+			size_t jMax = 0;
+			for ( size_t j = 0 ; j < numSegments; ++j) {
+				this->absolute_difference(val[j+1],val[j],diff[j]);
+				if ( integralAcc.first_lower_than_second(diff[jMax],diff[j]) )
+					jMax = j;
+			}
+			size_t jSecond = (jMax == 0 ? 1 : 0);
+			for ( size_t j = 0 ; j < numSegments; ++j)
+				if ( (j != jMax) and integralAcc.first_lower_than_second(diff[jSecond],diff[j]) )
+					jSecond = j;
+
+			size_t newLower, newUpper, numLevels;
+			result_type featureSize(_zeroOfResultType);
+			if ( integralAcc.first_lower_than_second(diff[jSecond]*dominance,diff[jMax]) ) {
+				newLower = jMax;
+				newUpper = jMax+1;
+				numLevels = 3;
+				featureSize = diff[jMax];
+			} else {
+				//a kink is within the two segments around the point where the second difference
+				//	dominates all others except the neighbors.
+				std::vector<result_type> diff2(numSegments+1,_zeroOfResultType);
+				size_t kMax = 1;
+				for ( size_t k = 1 ; k < numSegments; ++k) {
+					this->absolute_difference(val[k+1]+val[k-1],val[k]*static_cast<weight_type>(2),diff2[k]);
+					if ( integralAcc.first_lower_than_second(diff2[kMax],diff2[k]) )
+						kMax = k;
+				}
+				bool dominant = true;
+				for ( size_t k = 1 ; k < numSegments; ++k)
+					if ( ((k+1 < kMax) or (k > kMax+1)) and
+							(not integralAcc.first_lower_than_second(diff2[k]*dominance,diff2[kMax])) )
+						dominant = false;
+				if ( not dominant ) {
+					bracket.active = false;
+					continue;
+				}
+				newLower = kMax-1;
+				newUpper = kMax+1;
+				numLevels = 2;
+				featureSize = diff2[kMax];
+			}
+
+			argument_type lborder = this->sample_point(bracket.lborder,bracket.uborder,newLower,numSegments);
+			argument_type uborder = this->sample_point(bracket.lborder,bracket.uborder,newUpper,numSegments);
+			result_type valLower = val[newLower];
+			result_type valUpper = val[newUpper];
+			bracket.lborder = lborder;
+			bracket.uborder = uborder;
+			val[0] = valLower;
+			val[numSegments] = valUpper;
+			bracket.subdiv += numLevels;
+			bracket.found = true;
+
+			//stop once the feature times the width of the bracket is below the local error goal
+			if ( integralAcc.locally_sufficient(
+					featureSize*this->distance_argument_types(f,uborder,lborder),
+					suspiciousIntervals[i].integralVal) )
+				bracket.active = false;
+		}
+	}
+
+	//insert the bracket as breakpoints or bisect the interval if no jump or kink is found
+	for ( size_t i = 0 ; i < suspiciousIntervals.size(); ++i) {
+		Integrator::Interval interval = suspiciousIntervals[i];
+		interval.numStalledSubdiv = 0;
+		if ( not brackets[i].found ) {
+			Integrator::Interval intervalLower, intervalUpper;
+			this->split_interval(interval,intervalLower,intervalUpper);
+			intervalsNextLoop.push_back(intervalLower);
+			intervalsNextLoop.push_back(intervalUpper);
+			continue;
+		}
+		Integrator::Interval intervalLower = interval, intervalBracket = interval, intervalUpper = interval;
+		intervalLower.uborder = brackets[i].lborder;
+		intervalLower.subdiv += 1;
+		intervalBracket.lborder = brackets[i].lborder;
+		intervalBracket.uborder = brackets[i].uborder;
+		intervalBracket.subdiv = brackets[i].subdiv;
+		intervalUpper.lborder = brackets[i].uborder;
+		intervalUpper.subdiv += 1;
+		if ( this->distance_argument_types(f,intervalLower.uborder,intervalLower.lborder) > 0 )
+			intervalsNextLoop.push_back(intervalLower);
+		intervalsNextLoop.push_back(intervalBracket);
+		if ( this->distance_argument_types(f,intervalUpper.uborder,intervalUpper.lborder) > 0 )
+			intervalsNextLoop.push_back(intervalUpper);
+	}
+}
+
+template<class Function,size_t indexT>
+typename Integrator<Function,indexT>::argument_type
+Integrator<Function,indexT>::sample_point(argument_type lborder, argument_type uborder,
+		size_t i, size_t numSegments) const {
+	const weight_type t = static_cast<weight_type>(i)/static_cast<weight_type>(numSegments);
+	return lborder*(weight_type(1)-t) + uborder*t;
+}
+
 template<class Function,size_t indexT>
 void Integrator<Function,indexT>::non_adaptive_integral(
 		std::vector<argument_type> segmentPoints,
@@ -165,6 +441,7 @@ void Integrator<Function,indexT>::non_adaptive_integral(
 
 	//collect all points that need to be evaluated
 	std::vector<argument_type> points;
+	points.reserve(15*(segmentPoints.size() - 1));
 	for ( size_t i = 0 ; i < segmentPoints.size() - 1; ++i) {
 		this->add_interval_points(segmentPoints[i],segmentPoints[i+1],points);
 	}
@@ -185,43 +462,100 @@ void Integrator<Function,indexT>::non_adaptive_integral(
 
 		this->evaluate_integral_formula_for_interval(i,intervalLength,valueFAtPoints,localContribution,localErrEstim);
 
-		integral = integral + localContribution;
-		errorEstimation = errorEstimation + localErrEstim;
+		this->add_to(integral,localContribution);
+		this->add_to(errorEstimation,localErrEstim);
 	}
 }
 
 template<class Function,size_t indexT>
-void Integrator<Function,indexT>::get_kronrad_points(argument_type lborder,argument_type uborder, argument_type (&kronradPoints)[15]) const{
-	weight_type const tmp[15] = {-0.991455371120813,
-			-0.949107912342759,-0.864864423359769,-0.741531185599394,-0.586087235467691,
-			-0.405845151377397,-0.207784955007898,0.000000000000000,0.207784955007898,
-			0.405845151377397,0.586087235467691,0.741531185599394,0.864864423359769,
-			0.949107912342759,0.991455371120813};
-	//scale the points to the present interval
-	for ( size_t i = 0 ; i < 15; ++i){
-		kronradPoints[i] = ( uborder*(tmp[i]+1.0) - lborder*(tmp[i]-1.0) )*0.5;
-	};
-};
+void Integrator<Function,indexT>::gauss_legendre_integral(
+		std::vector<argument_type> const& segmentPoints,
+		size_t numNodes,
+		Function const &f,
+		result_type &integral) const {
+	this->set_to_zero(integral);
+	_zeroOfResultType = integral;
+	if ( segmentPoints.size() < 2 )
+		return;
 
-template<class Function,size_t indexT>
-void Integrator<Function,indexT>::get_kronrad_weights(weight_type (&kronradWeights)[15] ) const {
-	weight_type tmp[15] = {0.022935322010529,0.063092092629979,0.104790010322250,
-			0.140653259715525,0.169004726639267,0.190350578064785,0.204432940075298,0.209482141084728,
-			0.204432940075298,0.190350578064785,0.169004726639267,0.140653259715525,0.104790010322250,
-			0.063092092629979,0.022935322010529};
+	std::shared_ptr<const GaussQuadratureRule<weight_type> > rule =
+			GaussQuadratureRule<weight_type>::cached_rule(GaussQuadratureRule<weight_type>::LEGENDRE,numNodes);
+	std::vector<weight_type> const& nodes = rule->get_nodes();
+	std::vector<weight_type> const& weights = rule->get_weights();
 
-	for ( size_t i = 0 ; i < 15; ++i)
-		kronradWeights[i] = tmp[i];
-};
+	std::vector<argument_type> points;
+	points.reserve((segmentPoints.size()-1)*numNodes);
+	for ( size_t i = 0 ; i+1 < segmentPoints.size(); ++i)
+		for ( size_t j = 0 ; j < numNodes; ++j)
+			points.push_back( ( segmentPoints[i+1]*(nodes[j]+weight_type(1))
+					- segmentPoints[i]*(nodes[j]-weight_type(1)) )*weight_type(0.5) );
+
+	std::vector<result_type> valueFAtPoints;
+	valueFAtPoints.reserve(points.size());
+	this->evaluate_several_points(points,f,valueFAtPoints);
+
+	result_type localContribution(_zeroOfResultType);
+	for ( size_t i = 0 ; i+1 < segmentPoints.size(); ++i) {
+		const weight_type intervalLength =
+				this->distance_argument_types(f,segmentPoints[i],segmentPoints[i+1]);
+		this->set_to_zero(localContribution);
+		for ( size_t j = 0 ; j < numNodes; ++j)
+			this->add_scaled_to(localContribution,valueFAtPoints[i*numNodes+j],weights[j]);
+		this->add_scaled_to(integral,localContribution,intervalLength * static_cast<weight_type>(0.5));
+	}
+}
 
 template<class Function,size_t indexT>
-void Integrator<Function,indexT>::get_gauss_weights(weight_type (&gaussWeights)[7] ) const {
-	weight_type tmp[7] = {0.129484966168870,0.279705391489277,0.381830050505119,0.417959183673469,
-			0.381830050505119,0.279705391489277,0.129484966168870};
+Integrator<Function,indexT>::GaussKronradConstants::GaussKronradConstants() {
+	//The first half including the center of the symmetric nodes and weights.
+	//	The parts are added starting from the smallest to avoid rounding of the leading parts.
+	const double nodes[8][4] = {
+			{-0.9914553711208126, -2.7322067495382985e-17, -1.753392035063913e-34, -1.378519893890551e-51},
+			{-0.9491079123427585, -3.82579658786657e-17, -1.2953962404945294e-33, 4.509149012917882e-50},
+			{-0.8648644233597691, 2.3887783447584197e-17, 1.3139013462644826e-33, 8.049587485701331e-50},
+			{-0.7415311855993945, 2.0220134774069897e-17, 7.895895000258642e-34, 7.865574189846474e-50},
+			{-0.5860872354676911, 1.7466970805984817e-17, -8.686085912951804e-34, 5.71084438905328e-50},
+			{-0.4058451513773972, 1.72492754475471e-17, -7.800561159333333e-34, 5.428122117442244e-50},
+			{-0.20778495500789848, 1.322698778629045e-17, 4.980002907405574e-34, 3.542078255237184e-50},
+			{0.0, 0.0, 0.0, 0.0}};
+	const double kronrad[8][4] = {
+			{0.022935322010529224, 5.957180517223158e-19, -3.987690570567354e-35, 2.122826315313169e-51},
+			{0.06309209262997856, -4.536585404360517e-18, 1.1602025867471201e-34, 1.740418037888347e-51},
+			{0.10479001032225019, -3.90658597958814e-18, 2.414307963361136e-34, -5.985139096952702e-51},
+			{0.14065325971552592, -2.484164787968961e-19, 1.94070323367809e-36, -5.360559686146894e-53},
+			{0.1690047266392679, -7.56643290985809e-18, 7.26253372595988e-34, -1.1736940643848416e-50},
+			{0.19035057806478542, -9.616513280901216e-18, 6.800337276349138e-34, -2.6224290284684797e-51},
+			{0.20443294007529889, 6.740401802865974e-18, -3.4255613675878946e-34, -1.3953303294158106e-50},
+			{0.20948214108472782, 9.321252782204223e-18, -1.6648620709911648e-34, -3.1700064280373805e-51}};
+	const double gauss[4][4] = {
+			{0.1294849661688697, -9.625448970284404e-18, 4.718941623660267e-34, 3.578587066632468e-50},
+			{0.27970539148927664, 2.3267180221717138e-17, 3.4889621934950335e-34, 4.233767307841422e-52},
+			{0.3818300505051189, 2.1862747923824822e-17, 2.5207051138638804e-34, 1.4549281758470639e-50},
+			{0.4179591836734694, -1.5497807119257288e-17, 9.35766124815741e-34, 6.95398831347416e-50}};
+
+	for ( size_t i = 0 ; i < 8; ++i) {
+		weight_type node = ((weight_type(nodes[i][3]) + weight_type(nodes[i][2])) + weight_type(nodes[i][1]))
+				+ weight_type(nodes[i][0]);
+		kronradNodes[14-i] = -node;
+		kronradNodes[i] = node;
+		kronradWeights[i] = ((weight_type(kronrad[i][3]) + weight_type(kronrad[i][2])) + weight_type(kronrad[i][1]))
+				+ weight_type(kronrad[i][0]);
+		kronradWeights[14-i] = kronradWeights[i];
+	}
+	for ( size_t i = 0 ; i < 4; ++i) {
+		gaussWeights[i] = ((weight_type(gauss[i][3]) + weight_type(gauss[i][2])) + weight_type(gauss[i][1]))
+				+ weight_type(gauss[i][0]);
+		gaussWeights[6-i] = gaussWeights[i];
+	}
+}
 
-	for ( size_t i = 0 ; i < 7; ++i)
-		gaussWeights[i] = tmp[i];
-};
+template<class Function,size_t indexT>
+typename Integrator<Function,indexT>::GaussKronradConstants const&
+Integrator<Function,indexT>::gauss_kronrad_constants() {
+	//initialized once in a thread safe way
+	static const GaussKronradConstants constants;
+	return constants;
+}
 
 //We delegate to two implementations, one is simply evaluating the function using the operator()
 //	and one is calling the function evaluate_several_points(points,setOfEvaluatedPoints) if the
@@ -239,6 +573,7 @@ struct evaluate_several_points_impl<Function,result_type,argument_type,false> {
 			Function const &f,
 			std::vector<result_type> &setOfEvaluatedPoints){
 		setOfEvaluatedPoints.clear();
+		setOfEvaluatedPoints.reserve(points.size());
 		for (typename std::vector<argument_type>::const_iterator it = points.begin(); it != points.end(); ++it){
 			setOfEvaluatedPoints.push_back( f( *it) );
 		}
@@ -265,19 +600,191 @@ void Integrator<Function,indexT>::evaluate_several_points(std::vector<argument_t
 
 	//delegate to struct evaluate_several_points_impl above. See above documentation.
 	delegate::evaluate_several_points_impl<Function,result_type,argument_type,
-		gslpp::auxillary::has_evaluate_several_points<Function, result_type(argument_type) >::value
+		gslpp::auxillary::has_evaluate_several_points<Function const,
+			void(std::vector<argument_type> const&, std::vector<result_type>&) >::value
 		>::call(points,f,setOfEvaluatedPoints);
 };
 
 template<class Function,size_t indexT>
 void Integrator<Function,indexT>::add_interval_points(argument_type lborder,
 		argument_type uborder,std::vector<argument_type> &points) const {
-	argument_type newKronradPoints[15];
-	this->get_kronrad_points(lborder,uborder,newKronradPoints);
+	//the points are scaled in place at the end of the vector
+	GaussKronradConstants const& constants = gauss_kronrad_constants();
+	const size_t offset = points.size();
+	points.resize(offset+15);
 	for ( size_t i = 0 ; i < 15; ++i)
-			points.push_back(newKronradPoints[i]);
+		points[offset+i] = ( uborder*(constants.kronradNodes[i]+1.0) - lborder*(constants.kronradNodes[i]-1.0) )*0.5;
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::split_interval(Interval const& interval,
+		Interval &intervalLower, Interval &intervalUpper) const {
+	argument_type middle = ( interval.uborder + interval.lborder ) * weight_type(0.5);
+	intervalLower = interval;
+	intervalLower.subdiv += 1;
+	intervalUpper = intervalLower;
+	intervalLower.uborder = middle;
+	intervalUpper.lborder = middle;
+}
+
+template<class Function,size_t indexT>
+size_t Integrator<Function,indexT>::find_speculative_interval(
+		std::vector<SpeculativeInterval> const& speculativeIntervals,
+		argument_type lborder, argument_type uborder) const {
+	for ( size_t j = 0 ; j < speculativeIntervals.size(); ++j )
+		if ( (speculativeIntervals[j].lborder == lborder) and (speculativeIntervals[j].uborder == uborder) )
+			return j;
+	return speculativeIntervals.size();
 }
 
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::evaluate_intervals(std::vector<Interval> const& intervalsToBeDone,
+		Function const &f,
+		gslpp::auxillary::NumAccuracyControl<result_type> const& integralAcc,
+		std::vector<SpeculativeInterval> &speculativeIntervals,
+		std::vector<result_type> &valAtPoints,
+		size_t &numEvaluations) const {
+
+	//collect all points that need to be evaluated. Intervals that have been evaluated
+	//	speculatively in a previous loop are marked by the index of the cached values.
+	const size_t notCached = speculativeIntervals.size();
+	std::vector<size_t> cacheIndices(intervalsToBeDone.size(),notCached);
+	std::vector<argument_type> points;
+	points.reserve(15*intervalsToBeDone.size());
+	for ( size_t i = 0 ; i < intervalsToBeDone.size(); ++i) {
+		cacheIndices[i] = this->find_speculative_interval(speculativeIntervals,
+				intervalsToBeDone[i].lborder,intervalsToBeDone[i].uborder);
+		if ( cacheIndices[i] == notCached )
+			this->add_interval_points(intervalsToBeDone[i].lborder,intervalsToBeDone[i].uborder,points);
+	}
+
+	//If the function has to be called anyway, fill the batch up with subintervals of the intervals
+	//	with the largest error estimate. We go down level by level, where the order within a level is
+	//	given by the error estimate of the interval of this loop that the subinterval belongs to.
+	//	Speculative points must not exceed the maximal number of evaluations.
+	size_t batchWidth = _speculativeBatchWidth;
+	if ( integralAcc.get_max_num_evaluations() != 0 )
+		batchWidth = std::min(batchWidth,
+				integralAcc.get_max_num_evaluations() > numEvaluations ?
+						integralAcc.get_max_num_evaluations() - numEvaluations : size_t(0) );
+	std::vector<SpeculativeInterval> newSpeculativeIntervals;
+	if ( (not points.empty()) and (points.size() + 30 <= batchWidth) ) {
+		std::vector<Interval> candidates;
+		candidates.reserve(intervalsToBeDone.size());
+		std::vector<bool> isSelected(intervalsToBeDone.size(),false);
+		for ( size_t n = 0 ; n < intervalsToBeDone.size(); ++n) {
+			size_t iMax = intervalsToBeDone.size();
+			for ( size_t i = 0 ; i < intervalsToBeDone.size(); ++i) {
+				if ( isSelected[i] )
+					continue;
+				if ( (iMax == intervalsToBeDone.size()) or
+						integralAcc.first_lower_than_second(intervalsToBeDone[iMax].errEstim,intervalsToBeDone[i].errEstim) )
+					iMax = i;
+			}
+			isSelected[iMax] = true;
+			candidates.push_back(intervalsToBeDone[iMax]);
+		}
+
+		std::vector<Interval> candidatesNextLevel;
+		while ( (not candidates.empty()) and (points.size() + 30 <= batchWidth) ) {
+			for ( size_t i = 0 ; i < candidates.size(); ++i) {
+				if ( not integralAcc.sub_divisions_below_max(candidates[i].subdiv) )
+					continue;
+				Interval subIntervals[2];
+				this->split_interval(candidates[i],subIntervals[0],subIntervals[1]);
+				for ( size_t k = 0 ; k < 2; ++k) {
+					if ( (this->find_speculative_interval(speculativeIntervals,
+								subIntervals[k].lborder,subIntervals[k].uborder) == notCached) ) {
+						if ( points.size() + 15 > batchWidth )
+							break;
+						SpeculativeInterval speculativeInterval;
+						speculativeInterval.lborder = subIntervals[k].lborder;
+						speculativeInterval.uborder = subIntervals[k].uborder;
+						speculativeInterval.age = 0;
+						newSpeculativeIntervals.push_back(speculativeInterval);
+						this->add_interval_points(subIntervals[k].lborder,subIntervals[k].uborder,points);
+					}
+					candidatesNextLevel.push_back(subIntervals[k]);
+				}
+			}
+			candidates.swap(candidatesNextLevel);
+			candidatesNextLevel.clear();
+		}
+	}
+
+	std::vector<result_type> valAtNewPoints;
+	valAtNewPoints.reserve(points.size());
+	if ( not points.empty() )
+		this->evaluate_several_points(points,f,valAtNewPoints);
+	numEvaluations += points.size();
+
+	//assemble the values in the order of the intervals
+	valAtPoints.clear();
+	valAtPoints.reserve(15*intervalsToBeDone.size());
+	std::vector<bool> isUsed(speculativeIntervals.size(),false);
+	typename std::vector<result_type>::const_iterator itNewValue = valAtNewPoints.begin();
+	for ( size_t i = 0 ; i < intervalsToBeDone.size(); ++i) {
+		if ( cacheIndices[i] == notCached ) {
+			valAtPoints.insert(valAtPoints.end(),itNewValue,itNewValue+15);
+			itNewValue += 15;
+		} else {
+			std::vector<result_type> const& cachedValues = speculativeIntervals[cacheIndices[i]].valAtKronradPoints;
+			valAtPoints.insert(valAtPoints.end(),cachedValues.begin(),cachedValues.end());
+			isUsed[cacheIndices[i]] = true;
+		}
+	}
+
+	//keep the speculative values that have not been used for a limited number of loops
+	//	and add the new ones.
+	for ( size_t j = 0 ; j < speculativeIntervals.size(); ++j) {
+		if ( isUsed[j] or (speculativeIntervals[j].age >= _maxAgeSpeculativeInterval) )
+			continue;
+		newSpeculativeIntervals.push_back(speculativeIntervals[j]);
+		newSpeculativeIntervals.back().age += 1;
+	}
+	for ( size_t i = 0 ; itNewValue != valAtNewPoints.end(); ++i) {
+		newSpeculativeIntervals[i].valAtKronradPoints.assign(itNewValue,itNewValue+15);
+		itNewValue += 15;
+	}
+	speculativeIntervals.swap(newSpeculativeIntervals);
+}
+
+//For scalar floating point results, the Kronrad sum, the Gauss sum on every second point and the error
+//	estimate are computed in a single pass over the 15 contiguous values with the weights read in place.
+//	The generic version through the operators of result_type copies the weights and walks the values twice.
+//	Returns false if the type is not handled here.
+namespace delegate{
+template <typename T, bool isFloatingPoint = std::is_floating_point<T>::value>
+struct gauss_kronrad_sums_impl {
+	template<class... Arguments>
+	static bool call(Arguments&&...) {
+		return false;
+	};
+};
+
+template <typename T>
+struct gauss_kronrad_sums_impl<T,true> {
+	template<class ErrorFunctor>
+	static bool call(T const (&kronradWeights)[15], T const (&gaussWeights)[7],
+			T intervalLength, T const * values,
+			ErrorFunctor const& errorFunctor,
+			T &integral, T &errorEstimate) {
+		T kronrad = values[14]*kronradWeights[14];
+		T gauss = 0;
+		for ( size_t point = 0 ; point < 7; ++point) {
+			kronrad += values[2*point]*kronradWeights[2*point];
+			const T gaussPoint = values[2*point+1];
+			kronrad += gaussPoint*kronradWeights[2*point+1];
+			gauss += gaussPoint*gaussWeights[point];
+		}
+		const T halfLength = intervalLength*static_cast<T>(0.5);
+		integral = kronrad*halfLength;
+		errorEstimate = errorFunctor(gauss*halfLength,integral);
+		return true;
+	};
+};
+}/* namespace delegate */
+
 template<class Function,size_t indexT>
 void Integrator<Function,indexT>::evaluate_integral_formula_for_interval(
 		size_t indexOfIntervalInData,
@@ -291,23 +798,27 @@ void Integrator<Function,indexT>::evaluate_integral_formula_for_interval(
 	//TODO Check that integralOfInterval is zero
 #endif
 
-	weight_type kronradWeights[15];
-	this->get_kronrad_weights(kronradWeights);
+	//scalar floating point results use a single pass over the values, see gauss_kronrad_sums_impl
+	GaussKronradConstants const& constants = gauss_kronrad_constants();
+	if ( delegate::gauss_kronrad_sums_impl<result_type>::call(constants.kronradWeights,constants.gaussWeights,
+			intervalLength,&evaluatedPoints[indexOfIntervalInData*15],_errorEstimationFunctor,
+			integralOfInterval,errorEstiamteOfIntegral) )
+		return;
+
+	//container results are accumulated in place, such that only the Gauss estimate is allocated
+	const weight_type halfLength = intervalLength * static_cast<weight_type>(0.5);
 	for ( size_t point = 0 ; point < 15; ++point)
-		integralOfInterval = integralOfInterval +
-			evaluatedPoints[indexOfIntervalInData*15+point]*kronradWeights[point];
-	integralOfInterval = integralOfInterval * (intervalLength * static_cast<weight_type>(0.5));
-
-	result_type integralGauss = integralOfInterval;
-	this->set_to_zero(integralGauss);
-	weight_type gaussWeights[7];
-	this->get_gauss_weights(gaussWeights);
+		this->add_scaled_to(integralOfInterval,
+				evaluatedPoints[indexOfIntervalInData*15+point],constants.kronradWeights[point]);
+	this->scale(integralOfInterval,halfLength);
+
+	result_type integralGauss(_zeroOfResultType);
 	for ( size_t point = 0 ; point < 7; ++point)
-		integralGauss = integralGauss +
-			evaluatedPoints[15*indexOfIntervalInData+2*point+1]*gaussWeights[point];
-	integralGauss = integralGauss * (intervalLength * static_cast<weight_type>(0.5));
+		this->add_scaled_to(integralGauss,
+				evaluatedPoints[15*indexOfIntervalInData+2*point+1],constants.gaussWeights[point]);
+	this->scale(integralGauss,halfLength);
 
-	errorEstiamteOfIntegral = this->evaluate_error( integralGauss, integralOfInterval);
+	this->evaluate_error(integralGauss,integralOfInterval,errorEstiamteOfIntegral);
 }
 
 //We delegate to two implementations, one is simply evaluating the function using the operator()
@@ -321,7 +832,8 @@ template <class FuncT,class argumentT,class weightT>
 struct distance_argument_types_impl<FuncT,argumentT,weightT,false> {
 	static weightT call(
 			FuncT const& f,argumentT v1,argumentT v2) {
-		return std::fabs(v1 - v2);
+		using std::fabs;
+		return fabs(v1 - v2);
 	}
 };
 
@@ -346,7 +858,7 @@ typename Integrator<Function,indexT>::weight_type
 template<class Function,size_t indexT>
 typename Integrator<Function,indexT>::weight_type
 Integrator<Function,indexT>::gauss_kronrad_err_est(weight_type estimGauss, weight_type estimKronrad) const {
-	return std::pow(200.0*std::fabs(estimGauss-estimKronrad),1.5);
+	return _errorEstimationFunctor(estimGauss,estimKronrad);
 }
 
 namespace delegate{
@@ -376,31 +888,88 @@ void Integrator<Function,indexT>::set_to_zero(result_type & toBeSetZero) const{
 	delegate::assign_zero<result_type>::call(toBeSetZero);
 };
 
+//Types with an iterator, such as std::vector, are updated element by element, since the operators
+//	would allocate a temporary for every term. Other types use the operators, which for std::valarray
+//	are expression templates that are assigned in place.
+namespace delegate{
+template <typename T, typename W, bool THasIterator = auxillary::has_iterator<T>::value>
+struct in_place_arithmetic { };
+
+template <typename T, typename W>
+struct in_place_arithmetic<T,W,false> {
+	static void add(T & target, T const& value) {target = target + value;};
+
+	static void add_scaled(T & target, T const& value, W factor) {target = target + value*factor;};
+
+	static void scale(T & target, W factor) {target = target*factor;};
+};
+
+template <typename T, typename W>
+struct in_place_arithmetic<T,W,true> {
+	static void add(T & target, T const& value) {
+		auto itv = value.begin();
+		for ( auto &&element : target) {
+			element = element + *itv;
+			++itv;
+		}
+	};
+
+	static void add_scaled(T & target, T const& value, W factor) {
+		auto itv = value.begin();
+		for ( auto &&element : target) {
+			element = element + (*itv)*factor;
+			++itv;
+		}
+	};
+
+	static void scale(T & target, W factor) {
+		for ( auto &&element : target)
+			element = element*factor;
+	};
+};
+}/* namespace delegate */
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::add_to(result_type & target, result_type const& value) const{
+	delegate::in_place_arithmetic<result_type,weight_type>::add(target,value);
+};
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::add_scaled_to(result_type & target, result_type const& value, weight_type factor) const{
+	delegate::in_place_arithmetic<result_type,weight_type>::add_scaled(target,value,factor);
+};
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::scale(result_type & target, weight_type factor) const{
+	delegate::in_place_arithmetic<result_type,weight_type>::scale(target,factor);
+};
+
 namespace delegate{
 template <class method,typename T,  bool THasIterator>
 struct estimate_error_impl{ };
 
 template <class method,typename T>
 struct estimate_error_impl<method,T,false>{
-	static T call(method const& f,T const&estimateMethod1, T const &estimateMethod2){
-		return f(estimateMethod1,estimateMethod2);
+	static void call(method const& f,T const&estimateMethod1, T const &estimateMethod2, T &result){
+		result = f(estimateMethod1,estimateMethod2);
 	};
 };
 
+//specialization for std::complex is to perform the error estimation for real and imaginary parts independently
 template <class method,typename T>
 struct estimate_error_impl<method,std::complex<T>,false> {
-	static std::complex<T> call(method const& f,std::complex<T> const&estimateMethod1, std::complex<T> const&estimateMethod2){
-		return std::complex<T>(
+	static void call(method const& f,std::complex<T> const&estimateMethod1, std::complex<T> const&estimateMethod2,
+			std::complex<T> &result){
+		result = std::complex<T>(
 				f(estimateMethod1.real(),estimateMethod2.real()),
 				f(estimateMethod1.imag(),estimateMethod2.imag()));
 	};
 };
 
-//specialization for std::complex is to perform the error estimation for real and imaginary parts independently
+//the result must have the shape of the estimates, its elements are overwritten
 template <class method,typename T>
 struct estimate_error_impl<method,T,true> {
-	static T call(method const& f,T const& estim1, T const& estim2){
-		T result = estim1;
+	static void call(method const& f,T const& estim1, T const& estim2, T &result){
 		typename T::const_iterator it1,it2;
 		typename T::iterator itr;
 		it1 = estim1.begin();
@@ -411,15 +980,160 @@ struct estimate_error_impl<method,T,true> {
 			 ++it2;
 			 ++itr;
 		}
-		return result;
 	};
 };
 };/* namespace delegate*/
 template<class Function,size_t indexT>
-typename Integrator<Function,indexT>::result_type
-Integrator<Function,indexT>::evaluate_error(result_type const & estimate1, result_type const & estimate2) const{
-	return delegate::estimate_error_impl<ErrorEstimationFunctor,result_type,
-			auxillary::has_iterator<result_type>::value>::call(_errorEstimationFunctor,estimate1,estimate2);
+void Integrator<Function,indexT>::evaluate_error(result_type const & estimate1, result_type const & estimate2,
+		result_type & error) const{
+	delegate::estimate_error_impl<ErrorEstimationFunctor,result_type,
+			auxillary::has_iterator<result_type>::value>::call(_errorEstimationFunctor,estimate1,estimate2,error);
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::absolute_difference(result_type const & value1, result_type const & value2,
+		result_type & difference) const{
+	delegate::estimate_error_impl<AbsoluteDifferenceFunctor,result_type,
+			auxillary::has_iterator<result_type>::value>::call(AbsoluteDifferenceFunctor(),value1,value2,difference);
+}
+
+//We delegate the binary input and output of a single value to two implementations, one that stores the
+//	bytes of the object directly and one that stores all elements for types with an iterator.
+//	For the latter, the object to be read must already have the correct shape.
+namespace delegate{
+template <typename T,  bool THasIterator = auxillary::has_iterator<T>::value>
+struct binary_io { };
+
+template <typename T>
+struct binary_io<T,false> {
+	static void write(std::ostream &out, T const& value) {
+		out.write(reinterpret_cast<char const *>(&value),sizeof(T));
+	};
+	static bool read(std::istream &in, T & value) {
+		in.read(reinterpret_cast<char *>(&value),sizeof(T));
+		return in.good();
+	};
+};
+
+template <typename T>
+struct binary_io<T,true> {
+	typedef typename std::iterator_traits<typename T::iterator>::value_type element_type;
+
+	static void write(std::ostream &out, T const& value) {
+		uint64_t numElements = std::distance(value.begin(),value.end());
+		out.write(reinterpret_cast<char const *>(&numElements),sizeof(uint64_t));
+		for ( auto it = value.begin(); it != value.end(); ++it)
+			binary_io<element_type>::write(out,*it);
+	};
+	static bool read(std::istream &in, T & value) {
+		uint64_t numElements;
+		in.read(reinterpret_cast<char *>(&numElements),sizeof(uint64_t));
+		if ( numElements != static_cast<uint64_t>(std::distance(value.begin(),value.end())) )
+			return false;
+		for ( auto it = value.begin(); it != value.end(); ++it)
+			if ( not binary_io<element_type>::read(in,*it) )
+				return false;
+		return in.good();
+	};
+};
+}/* namespace delegate */
+
+namespace detail {
+//identifies the file format and its version
+static const char checkpointMagic[8] = {'G','S','L','P','P','I','N','T'};
+static const uint32_t checkpointVersion = 2;
+//reads differently on machines with a different byte order
+static const uint32_t checkpointByteOrderMark = 0x01020304;
+}/* namespace detail */
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::write_checkpoint(std::string const& fileName, AdaptiveState const& state) const {
+
+	//write to a temporary file first and rename it such that a checkpoint on disc is always complete
+	std::string tmpFileName = fileName + ".tmp";
+	std::ofstream file(tmpFileName.c_str(), std::ios::binary | std::ios::trunc);
+	if ( not file.good() )
+		gslpp::error_handling::Error( "Unable to open the checkpoint file "+tmpFileName+" for writing",
+				gslpp::error_handling::Error::FILE_IO_ERR);
+
+	file.write(detail::checkpointMagic,sizeof(detail::checkpointMagic));
+	file.write(reinterpret_cast<char const *>(&detail::checkpointVersion),sizeof(uint32_t));
+	file.write(reinterpret_cast<char const *>(&detail::checkpointByteOrderMark),sizeof(uint32_t));
+	uint32_t sizeOfTypes[2] = {sizeof(argument_type), sizeof(weight_type)};
+	file.write(reinterpret_cast<char const *>(sizeOfTypes),sizeof(sizeOfTypes));
+	uint64_t counters[2] = {state.numEvaluations,state.numLoops};
+	file.write(reinterpret_cast<char const *>(counters),sizeof(counters));
+
+	std::vector<Interval> const* intervalLists[2] = {&state.intervals,&state.intervalsToBeDone};
+	for ( size_t list = 0 ; list < 2; ++list ) {
+		uint64_t numIntervals = intervalLists[list]->size();
+		file.write(reinterpret_cast<char const *>(&numIntervals),sizeof(uint64_t));
+		for ( auto it = intervalLists[list]->begin(); it != intervalLists[list]->end(); ++it ) {
+			delegate::binary_io<argument_type>::write(file,it->lborder);
+			delegate::binary_io<argument_type>::write(file,it->uborder);
+			delegate::binary_io<result_type>::write(file,it->integralVal);
+			delegate::binary_io<result_type>::write(file,it->errEstim);
+			uint64_t subdivCounters[2] = {it->subdiv, it->numStalledSubdiv};
+			file.write(reinterpret_cast<char const *>(subdivCounters),sizeof(subdivCounters));
+		}
+	}
+	file.close();
+	if ( file.fail() or (std::rename(tmpFileName.c_str(),fileName.c_str()) != 0) )
+		gslpp::error_handling::Error( "Unable to write the checkpoint file "+fileName,
+				gslpp::error_handling::Error::FILE_IO_ERR);
+}
+
+template<class Function,size_t indexT>
+void Integrator<Function,indexT>::read_checkpoint(std::string const& fileName, AdaptiveState & state) const {
+	std::ifstream file(fileName.c_str(), std::ios::binary);
+	if ( not file.good() )
+		gslpp::error_handling::Error( "Unable to open the checkpoint file "+fileName+" for reading",
+				gslpp::error_handling::Error::FILE_IO_ERR);
+
+	char magic[sizeof(detail::checkpointMagic)];
+	uint32_t version, byteOrderMark;
+	uint32_t sizeOfTypes[2];
+	file.read(magic,sizeof(magic));
+	file.read(reinterpret_cast<char *>(&version),sizeof(uint32_t));
+	file.read(reinterpret_cast<char *>(&byteOrderMark),sizeof(uint32_t));
+	file.read(reinterpret_cast<char *>(sizeOfTypes),sizeof(sizeOfTypes));
+	if ( (not file.good()) or (not std::equal(magic,magic+sizeof(magic),detail::checkpointMagic))
+			or (version != detail::checkpointVersion) or (byteOrderMark != detail::checkpointByteOrderMark)
+			or (sizeOfTypes[0] != sizeof(argument_type)) or (sizeOfTypes[1] != sizeof(weight_type)) )
+		gslpp::error_handling::Error( "The file "+fileName+" is not a checkpoint of this integration type",
+				gslpp::error_handling::Error::INPUT_ERROR);
+
+	uint64_t counters[2];
+	file.read(reinterpret_cast<char *>(counters),sizeof(counters));
+	state.numEvaluations = counters[0];
+	state.numLoops = counters[1];
+
+	std::vector<Interval> * intervalLists[2] = {&state.intervals,&state.intervalsToBeDone};
+	for ( size_t list = 0 ; list < 2; ++list ) {
+		uint64_t numIntervals = 0;
+		file.read(reinterpret_cast<char *>(&numIntervals),sizeof(uint64_t));
+		intervalLists[list]->clear();
+		Interval interval;
+		interval.integralVal = _zeroOfResultType;
+		interval.errEstim = _zeroOfResultType;
+		for ( uint64_t i = 0 ; (i < numIntervals) and file.good(); ++i ) {
+			uint64_t subdivCounters[2];
+			bool success = delegate::binary_io<argument_type>::read(file,interval.lborder)
+					and delegate::binary_io<argument_type>::read(file,interval.uborder)
+					and delegate::binary_io<result_type>::read(file,interval.integralVal)
+					and delegate::binary_io<result_type>::read(file,interval.errEstim);
+			file.read(reinterpret_cast<char *>(subdivCounters),sizeof(subdivCounters));
+			if ( not success )
+				break;
+			interval.subdiv = subdivCounters[0];
+			interval.numStalledSubdiv = subdivCounters[1];
+			intervalLists[list]->push_back(interval);
+		}
+		if ( (not file.good()) or (intervalLists[list]->size() != numIntervals) )
+			gslpp::error_handling::Error( "The checkpoint file "+fileName+" is truncated or does not match "
+					"the shape of the integral",
+					gslpp::error_handling::Error::INPUT_ERROR);
+	}
 }
 
 template<class Function,size_t indexT>
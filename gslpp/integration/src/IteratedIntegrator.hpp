@@ -0,0 +1,155 @@
+/*
+ * IteratedIntegrator.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/integration/IteratedIntegrator.h"
+#include "gslpp/error_handling/Error.h"
+#include "gslpp/auxillary/ParallelRanges.h"
+#include <thread>
+#include <algorithm>
+#include <string>
+
+namespace gslpp {
+namespace integration {
+
+template<class Function, size_t ... indices>
+template<size_t ... i>
+struct IteratedIntegrator<Function,indices...>::argument_tuple_trait< gslpp::auxillary::index_sequence<i...> > {
+	typedef std::tuple< typename std::decay<
+			typename gslpp::auxillary::FunctionTraits<Function>::template arg<i>::type >::type... > type;
+};
+
+//The function of the argument at a given level of the nested integrals. The values of the arguments
+//	of the outer levels are bound in _point. Evaluating it for the innermost level calls the Function.
+template<class Function, size_t ... indices>
+template<size_t level>
+class IteratedIntegrator<Function,indices...>::LevelFunction<level,true> {
+public:
+	static const size_t argumentIndex = gslpp::auxillary::index_sequence_element<level,integration_indices>::value;
+
+	typedef typename std::tuple_element<argumentIndex,argument_tuple>::type argument_type;
+
+	LevelFunction(IteratedIntegrator const& /*iterated*/, Function const &f,
+			argument_tuple const& point, argument_tuple const& /*uborders*/)
+		: _f(f), _point(point) { };
+
+	result_type operator() (argument_type x) const {
+		argument_tuple point(_point);
+		std::get<argumentIndex>(point) = x;
+		return IteratedIntegrator::call_function(_f,point,all_argument_indices());
+	}
+private:
+	Function const &_f;
+
+	argument_tuple _point;
+};
+
+//Evaluating the function at levels other than the innermost computes the integral of the next level.
+template<class Function, size_t ... indices>
+template<size_t level>
+class IteratedIntegrator<Function,indices...>::LevelFunction<level,false> {
+public:
+	static const size_t argumentIndex = gslpp::auxillary::index_sequence_element<level,integration_indices>::value;
+
+	typedef typename std::tuple_element<argumentIndex,argument_tuple>::type argument_type;
+
+	LevelFunction(IteratedIntegrator const& iterated, Function const &f,
+			argument_tuple const& point, argument_tuple const& uborders)
+		: _iterated(iterated), _f(f), _point(point), _uborders(uborders) { };
+
+	result_type operator() (argument_type x) const {
+		typedef LevelFunction<level+1> InnerFunction;
+		argument_tuple point(_point);
+		std::get<argumentIndex>(point) = x;
+
+		//the element of the argument of the next level still holds its lower border
+		InnerFunction innerFunction(_iterated,_f,point,_uborders);
+		Integrator<InnerFunction> integrator;
+		gslpp::auxillary::NumAccuracyControl<result_type> innerAcc(_iterated._levelAcc[level+1]);
+		result_type integral;
+		integrator.integrate(std::get<InnerFunction::argumentIndex>(point),
+				std::get<InnerFunction::argumentIndex>(_uborders),
+				innerFunction,integral,innerAcc);
+		return integral;
+	}
+
+	void evaluate_several_points(std::vector<argument_type> const &points,
+			std::vector<result_type> &setOfEvaluatedPoints) const {
+		_iterated.evaluate_inner_integrals(*this,points,setOfEvaluatedPoints);
+	}
+private:
+	IteratedIntegrator const& _iterated;
+
+	Function const &_f;
+
+	argument_tuple _point;
+
+	argument_tuple const& _uborders;
+};
+
+template<class Function, size_t ... indices>
+IteratedIntegrator<Function,indices...>::IteratedIntegrator()
+	: _numThreads(std::max(std::thread::hardware_concurrency(),1u)), _levelAcc(numLevels) {
+}
+
+template<class Function, size_t ... indices>
+void IteratedIntegrator<Function,indices...>::set_num_threads(size_t numThreads) {
+	_numThreads = ( numThreads > 0 ? numThreads : 1 );
+}
+
+template<class Function, size_t ... indices>
+void IteratedIntegrator<Function,indices...>::set_accuracy_control(size_t level,
+		gslpp::auxillary::NumAccuracyControl<result_type> const& levelAcc) {
+	if ( (level == 0) or (level >= numLevels) )
+		gslpp::error_handling::Error( "The level of an inner integral must be > 0 and < "+std::to_string(numLevels)
+				+", got "+std::to_string(level),gslpp::error_handling::Error::INPUT_ERROR);
+	_levelAcc[level] = levelAcc;
+}
+
+template<class Function, size_t ... indices>
+void IteratedIntegrator<Function,indices...>::integrate(
+		argument_tuple const& lborders, argument_tuple const& uborders,
+		Function const &f,
+		result_type &integral,
+		gslpp::auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+	typedef LevelFunction<0> OuterFunction;
+	OuterFunction outerFunction(*this,f,lborders,uborders);
+	Integrator<OuterFunction> integrator;
+	integrator.integrate(std::get<OuterFunction::argumentIndex>(lborders),
+			std::get<OuterFunction::argumentIndex>(uborders),
+			outerFunction,integral,integralAcc);
+}
+
+template<class Function, size_t ... indices>
+template<size_t level>
+void IteratedIntegrator<Function,indices...>::evaluate_inner_integrals(
+		LevelFunction<level,false> const& levelFunction,
+		std::vector<typename LevelFunction<level,false>::argument_type> const &points,
+		std::vector<result_type> &setOfEvaluatedPoints) const {
+	setOfEvaluatedPoints.assign(points.size(),result_type());
+
+	//Only the points of the outermost integral are distributed over threads. The inner levels
+	//	run in the thread of their outer point, which avoids oversubscribing the cores.
+	const size_t numThreads = ( level == 0 ? gslpp::auxillary::num_threads_for_items(_numThreads,points.size(),1) : 1 );
+
+	//each thread computes a contiguous range of points
+	gslpp::auxillary::for_each_range_in_parallel(0,points.size(),numThreads,
+			[&] (size_t, size_t begin, size_t end) {
+				for ( size_t i = begin ; i < end; ++i)
+					setOfEvaluatedPoints[i] = levelFunction(points[i]);
+			});
+}
+
+template<class Function, size_t ... indices>
+template<size_t ... i>
+typename IteratedIntegrator<Function,indices...>::result_type
+IteratedIntegrator<Function,indices...>::call_function(Function const &f, argument_tuple const& point,
+		gslpp::auxillary::index_sequence<i...>) {
+	return f(std::get<i>(point)...);
+}
+
+} /* namespace integration */
+} /* namespace gslpp */
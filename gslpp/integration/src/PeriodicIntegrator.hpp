@@ -0,0 +1,216 @@
+/*
+ * PeriodicIntegrator.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/integration/PeriodicIntegrator.h"
+#include "gslpp/integration/Integrator.h"
+#include "gslpp/auxillary/has_function_signature.h"
+#include "gslpp/auxillary/has_iterator.h"
+#include <fftw3.h>
+#include <cmath>
+#include <complex>
+#include <mutex>
+
+namespace gslpp {
+namespace integration {
+
+template<class Function,size_t indexT>
+PeriodicIntegrator<Function,indexT>::PeriodicIntegrator() : _initialNumSamples(8), _maxNumSamples(1 << 20) {
+}
+
+template<class Function,size_t indexT>
+void PeriodicIntegrator<Function,indexT>::set_initial_num_samples(size_t numSamples) {
+	_initialNumSamples = ( numSamples > 0 ? numSamples : 1 );
+}
+
+template<class Function,size_t indexT>
+void PeriodicIntegrator<Function,indexT>::set_max_num_samples(size_t numSamples) {
+	_maxNumSamples = numSamples;
+}
+
+template<class Function,size_t indexT>
+void PeriodicIntegrator<Function,indexT>::integrate(
+		argument_type lborder, argument_type uborder,
+		Function const &f,
+		result_type &integral,
+		auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+	std::vector<result_type> valAtPoints;
+	this->trapezoidal_doubling(lborder,uborder,f,valAtPoints,integral,integralAcc);
+}
+
+//We delegate the Fourier transform to FFTW for double and std::complex<double>. Other types do not compile.
+namespace delegate{
+//only fftw_execute is thread safe in FFTW, the creation and destruction of plans must be serialized
+inline std::mutex & fftw_planner_mutex() {
+	static std::mutex mutex;
+	return mutex;
+}
+
+template <typename T>
+struct fourier_transform_impl { };
+
+template <>
+struct fourier_transform_impl<double> {
+	static void call(std::vector<double> const& valAtPoints, std::vector< std::complex<double> > &coefficients){
+		int numPoints = static_cast<int>(valAtPoints.size());
+		std::vector<double> in(valAtPoints);
+		coefficients.assign(valAtPoints.size()/2+1,std::complex<double>(0));
+		fftw_plan plan;
+		{
+			std::lock_guard<std::mutex> lock(fftw_planner_mutex());
+			plan = fftw_plan_dft_r2c_1d(numPoints,in.data(),
+					reinterpret_cast<fftw_complex*>(coefficients.data()),FFTW_ESTIMATE);
+		}
+		fftw_execute(plan);
+		std::lock_guard<std::mutex> lock(fftw_planner_mutex());
+		fftw_destroy_plan(plan);
+	};
+};
+
+template <>
+struct fourier_transform_impl< std::complex<double> > {
+	static void call(std::vector< std::complex<double> > const& valAtPoints,
+			std::vector< std::complex<double> > &coefficients){
+		int numPoints = static_cast<int>(valAtPoints.size());
+		std::vector< std::complex<double> > in(valAtPoints);
+		coefficients.assign(valAtPoints.size(),std::complex<double>(0));
+		fftw_plan plan;
+		{
+			std::lock_guard<std::mutex> lock(fftw_planner_mutex());
+			plan = fftw_plan_dft_1d(numPoints,reinterpret_cast<fftw_complex*>(in.data()),
+					reinterpret_cast<fftw_complex*>(coefficients.data()),FFTW_FORWARD,FFTW_ESTIMATE);
+		}
+		fftw_execute(plan);
+		std::lock_guard<std::mutex> lock(fftw_planner_mutex());
+		fftw_destroy_plan(plan);
+	};
+};
+}; /* namespace delegate */
+
+template<class Function,size_t indexT>
+void PeriodicIntegrator<Function,indexT>::fourier_coefficients(
+		argument_type lborder, argument_type uborder,
+		Function const &f,
+		std::vector< std::complex<weight_type> > &coefficients,
+		auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+	std::vector<result_type> valAtPoints;
+	result_type integral;
+	this->trapezoidal_doubling(lborder,uborder,f,valAtPoints,integral,integralAcc);
+
+	delegate::fourier_transform_impl<result_type>::call(valAtPoints,coefficients);
+	const weight_type norm = weight_type(1)/static_cast<weight_type>(valAtPoints.size());
+	for ( auto &c : coefficients )
+		c *= norm;
+}
+
+template<class Function,size_t indexT>
+void PeriodicIntegrator<Function,indexT>::trapezoidal_doubling(
+		argument_type lborder, argument_type uborder,
+		Function const &f,
+		std::vector<result_type> &valAtPoints,
+		result_type &integral,
+		auxillary::NumAccuracyControl<result_type> &integralAcc) const {
+
+	//the integral is the mean value of the points times the period
+	using std::fabs;
+	const weight_type period = fabs(uborder - lborder);
+	size_t numPoints = _initialNumSamples;
+	std::vector<argument_type> points;
+	points.reserve(numPoints);
+	for ( size_t i = 0 ; i < numPoints; ++i)
+		points.push_back(this->sample_point(lborder,uborder,i,numPoints));
+	this->evaluate_several_points(points,f,valAtPoints);
+	size_t numEvaluations = numPoints;
+	integralAcc.set_budget_exhausted(false);
+
+	result_type sum = valAtPoints.front();
+	for ( size_t i = 1 ; i < numPoints; ++i)
+		sum = sum + valAtPoints[i];
+	integral = sum * (period/static_cast<weight_type>(numPoints));
+
+	//without a second approximation, the error is estimated by the integral itself
+	result_type errEstim = this->absolute_difference(integral,integral*weight_type(2));
+
+	for ( size_t numDoublings = 1 ; ; ++numDoublings ) {
+		if ( (not integralAcc.sub_divisions_below_max(numDoublings)) or (2*numPoints > _maxNumSamples) )
+			break;
+		if ( not integralAcc.budget_allows(numEvaluations + numPoints) ) {
+			integralAcc.set_budget_exhausted(true);
+			break;
+		}
+
+		//the new points are the midpoints of the previous ones
+		points.clear();
+		for ( size_t i = 0 ; i < numPoints; ++i)
+			points.push_back(this->sample_point(lborder,uborder,2*i+1,2*numPoints));
+		std::vector<result_type> valAtNewPoints;
+		valAtNewPoints.reserve(numPoints);
+		this->evaluate_several_points(points,f,valAtNewPoints);
+		numEvaluations += numPoints;
+
+		std::vector<result_type> valAtAllPoints;
+		valAtAllPoints.reserve(2*numPoints);
+		for ( size_t i = 0 ; i < numPoints; ++i) {
+			valAtAllPoints.push_back(valAtPoints[i]);
+			valAtAllPoints.push_back(valAtNewPoints[i]);
+			sum = sum + valAtNewPoints[i];
+		}
+		valAtPoints.swap(valAtAllPoints);
+		numPoints *= 2;
+
+		result_type newIntegral = sum * (period/static_cast<weight_type>(numPoints));
+		errEstim = this->absolute_difference(newIntegral,integral);
+		integral = newIntegral;
+
+		if ( integralAcc.global_sufficient(errEstim,integral) )
+			break;
+	}
+
+	integralAcc.set_abs_error_estimate(errEstim);
+}
+
+template<class Function,size_t indexT>
+typename PeriodicIntegrator<Function,indexT>::argument_type
+PeriodicIntegrator<Function,indexT>::sample_point(argument_type lborder, argument_type uborder,
+		size_t i, size_t numSegments) const {
+	const weight_type t = static_cast<weight_type>(i)/static_cast<weight_type>(numSegments);
+	return lborder*(weight_type(1)-t) + uborder*t;
+}
+
+template<class Function,size_t indexT>
+void PeriodicIntegrator<Function,indexT>::evaluate_several_points(std::vector<argument_type> const &points,
+		Function const &f,
+		std::vector<result_type> &setOfEvaluatedPoints) const{
+	//see the documentation of Integrator.evaluate_several_points
+	delegate::evaluate_several_points_impl<Function,result_type,argument_type,
+		gslpp::auxillary::has_evaluate_several_points<Function const,
+			void(std::vector<argument_type> const&, std::vector<result_type>&) >::value
+		>::call(points,f,setOfEvaluatedPoints);
+};
+
+template<class Function,size_t indexT>
+typename PeriodicIntegrator<Function,indexT>::result_type
+PeriodicIntegrator<Function,indexT>::absolute_difference(result_type const & value1, result_type const & value2) const{
+	result_type difference(value1);
+	delegate::estimate_error_impl<AbsoluteDifferenceFunctor,result_type,
+			auxillary::has_iterator<result_type>::value>::call(AbsoluteDifferenceFunctor(),value1,value2,difference);
+	return difference;
+}
+
+template<class Function,size_t indexT>
+template<typename T>
+struct PeriodicIntegrator<Function,indexT>::result_type_trait<T,false>{
+		typedef T value_type;
+};
+
+template<class Function,size_t indexT>
+template<typename T>
+struct PeriodicIntegrator<Function,indexT>::result_type_trait<T,true>{
+	typedef typename T::value_type value_type;
+};
+
+} /* namespace integration */
+} /* namespace gslpp */
@@ -0,0 +1,338 @@
+/*
+ * SampledDataIntegrator.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/integration/SampledDataIntegrator.h"
+#include "gslpp/error_handling/Error.h"
+#include "gslpp/auxillary/ParallelRanges.h"
+#include <thread>
+#include <algorithm>
+
+namespace gslpp {
+namespace integration {
+
+//The sums are split into units, which are the intervals of the trapezoidal and cubic rules and the
+//	pairs of intervals of Simpson's rule. The kernels are instantiated for each rule and for uniform
+//	and non-uniform data, such that the innermost loops contain no branches on the rule.
+namespace delegate{
+
+//The integral over [a,b] of the polynomial through numPoints (3 or 4) samples.
+template<typename T>
+T lagrange_integral(T const * x, T const * f, size_t numPoints, T a, T b) {
+	const T length = b - a;
+	T result = 0;
+	for ( size_t j = 0 ; j < numPoints; ++j) {
+		//elementary symmetric polynomials of the other nodes, shifted by a
+		T e1 = 0, e2 = 0, e3 = 1, denominator = 1;
+		for ( size_t k = 0 ; k < numPoints; ++k) {
+			if ( k == j )
+				continue;
+			const T t = x[k] - a;
+			e2 += e1*t;
+			e1 += t;
+			e3 *= t;
+			denominator *= x[j] - x[k];
+		}
+		T basisIntegral;
+		if ( numPoints == 3 )
+			basisIntegral = length*(length*length/T(3) - e1*length/T(2) + e3);
+		else
+			basisIntegral = length*(length*length*length/T(4) - e1*length*length/T(3) + e2*length/T(2) - e3);
+		result += f[j]*basisIntegral/denominator;
+	}
+	return result;
+}
+
+template<typename T, int rule, bool uniform>
+struct sampled_data_kernel {
+
+	static size_t first_sample(size_t unit) {
+		if ( rule == 1 )
+			return 2*unit;
+		if ( rule == 2 )
+			return ( unit == 0 ? 0 : unit-1 );
+		return unit;
+	}
+
+	//x and f point to the first sample of the stencil. x is not used for uniform data.
+	static T unit_contribution(T const * x, T const * f, T spacing, bool firstUnit) {
+		if ( rule == 0 ) {
+			const T length = ( uniform ? spacing : x[1]-x[0] );
+			return length*T(0.5)*(f[0]+f[1]);
+		}
+		if ( rule == 1 ) {
+			if ( uniform )
+				return spacing/T(3)*(f[0]+T(4)*f[1]+f[2]);
+			return lagrange_integral(x,f,3,x[0],x[2]);
+		}
+		if ( firstUnit ) {
+			if ( uniform )
+				return spacing/T(24)*(T(9)*f[0]+T(19)*f[1]-T(5)*f[2]+f[3]);
+			return lagrange_integral(x,f,4,x[0],x[1]);
+		}
+		if ( uniform )
+			return spacing/T(24)*(T(13)*(f[1]+f[2])-f[0]-f[3]);
+		return lagrange_integral(x,f,4,x[1],x[2]);
+	}
+
+	static T unit_at(T const * x, T const * f, size_t base, size_t unit, T spacing) {
+		const size_t offset = first_sample(unit) - base;
+		return unit_contribution(( uniform ? x : x + offset ),f + offset,spacing,(rule == 2) and (unit == 0));
+	}
+
+	//pairwise summation down to blocks that are summed with independent partial sums
+	static T sum_range(T const * x, T const * f, size_t base, size_t unitBegin, size_t unitEnd, T spacing) {
+		const size_t blockSize = 1024;
+		if ( unitEnd - unitBegin > blockSize ) {
+			const size_t unitMiddle = unitBegin + (unitEnd - unitBegin)/2;
+			return sum_range(x,f,base,unitBegin,unitMiddle,spacing) + sum_range(x,f,base,unitMiddle,unitEnd,spacing);
+		}
+		const size_t numLanes = 8;
+		T lanes[numLanes];
+		for ( size_t l = 0 ; l < numLanes; ++l)
+			lanes[l] = 0;
+		size_t unit = unitBegin;
+		for ( ; unit + numLanes <= unitEnd; unit += numLanes)
+			for ( size_t l = 0 ; l < numLanes; ++l)
+				lanes[l] += unit_at(x,f,base,unit+l,spacing);
+		for ( ; unit < unitEnd; ++unit)
+			lanes[0] += unit_at(x,f,base,unit,spacing);
+		return ((lanes[0]+lanes[1])+(lanes[2]+lanes[3]))+((lanes[4]+lanes[5])+(lanes[6]+lanes[7]));
+	}
+};
+
+template<typename T>
+T sum_sampled_data(int rule, bool uniform,
+		T const * x, T const * f, size_t base, size_t unitBegin, size_t unitEnd, T spacing) {
+	switch ( rule ) {
+	case 0 :
+		return ( uniform ? sampled_data_kernel<T,0,true>::sum_range(x,f,base,unitBegin,unitEnd,spacing)
+				: sampled_data_kernel<T,0,false>::sum_range(x,f,base,unitBegin,unitEnd,spacing) );
+	case 1 :
+		return ( uniform ? sampled_data_kernel<T,1,true>::sum_range(x,f,base,unitBegin,unitEnd,spacing)
+				: sampled_data_kernel<T,1,false>::sum_range(x,f,base,unitBegin,unitEnd,spacing) );
+	default :
+		return ( uniform ? sampled_data_kernel<T,2,true>::sum_range(x,f,base,unitBegin,unitEnd,spacing)
+				: sampled_data_kernel<T,2,false>::sum_range(x,f,base,unitBegin,unitEnd,spacing) );
+	}
+}
+}; /* namespace delegate */
+
+template<typename T>
+SampledDataIntegrator<T>::SampledDataIntegrator(Rule rule) :
+	_rule(rule), _numThreads(std::max(std::thread::hardware_concurrency(),1u)),
+	_streamActive(false), _uniform(true), _spacing(0),
+	_numSamples(0), _nextUnit(0), _sum(0), _bufferStart(0) {
+}
+
+template<typename T>
+void SampledDataIntegrator<T>::set_num_threads(size_t numThreads) {
+	_numThreads = ( numThreads > 0 ? numThreads : 1 );
+}
+
+template<typename T>
+void SampledDataIntegrator<T>::begin_uniform(T spacing) {
+	_streamActive = true;
+	_uniform = true;
+	_spacing = spacing;
+	_numSamples = 0;
+	_nextUnit = 0;
+	_sum = 0;
+	_bufferStart = 0;
+	_bufferAbscissae.clear();
+	_bufferValues.clear();
+}
+
+template<typename T>
+void SampledDataIntegrator<T>::begin_nonuniform() {
+	this->begin_uniform(T(0));
+	_uniform = false;
+}
+
+template<typename T>
+void SampledDataIntegrator<T>::push(T const * values, size_t numSamples) {
+	if ( (not _streamActive) or (not _uniform) )
+		gslpp::error_handling::Error( "Push of uniform samples without begin_uniform",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	this->push_samples(0,values,numSamples);
+}
+
+template<typename T>
+void SampledDataIntegrator<T>::push(T const * abscissae, T const * values, size_t numSamples) {
+	if ( (not _streamActive) or _uniform )
+		gslpp::error_handling::Error( "Push of non-uniform samples without begin_nonuniform",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	this->push_samples(abscissae,values,numSamples);
+}
+
+template<typename T>
+size_t SampledDataIntegrator<T>::first_sample_of_unit(size_t unit) const {
+	switch ( _rule ) {
+	case SIMPSON :
+		return 2*unit;
+	case CUBIC :
+		return ( unit == 0 ? 0 : unit-1 );
+	default :
+		return unit;
+	}
+}
+
+template<typename T>
+size_t SampledDataIntegrator<T>::num_complete_units(size_t numSamples) const {
+	//the last interval of the cubic rule and an odd interval of Simpson's rule are left to finish()
+	switch ( _rule ) {
+	case SIMPSON :
+		return ( numSamples >= 3 ? (numSamples-1)/2 : 0 );
+	case CUBIC :
+		return ( numSamples >= 4 ? numSamples-2 : 0 );
+	default :
+		return ( numSamples >= 2 ? numSamples-1 : 0 );
+	}
+}
+
+template<typename T>
+void SampledDataIntegrator<T>::push_samples(T const * abscissae, T const * values, size_t numSamples) {
+	if ( numSamples == 0 )
+		return;
+	const size_t numPrevious = _numSamples;
+	const size_t numTotal = numPrevious + numSamples;
+	const size_t numCompleteUnits = this->num_complete_units(numTotal);
+
+	//units whose stencil starts in the buffer are summed from a copy of the buffer and the
+	//	first new samples. A stencil spans at most four samples.
+	if ( (numPrevious > 0) and (_nextUnit < numCompleteUnits) ) {
+		std::vector<T> seamAbscissae(_bufferAbscissae), seamValues(_bufferValues);
+		const size_t numSeam = std::min(numSamples,size_t(3));
+		seamValues.insert(seamValues.end(),values,values+numSeam);
+		if ( not _uniform )
+			seamAbscissae.insert(seamAbscissae.end(),abscissae,abscissae+numSeam);
+		while ( (_nextUnit < numCompleteUnits) and (this->first_sample_of_unit(_nextUnit) < numPrevious) ) {
+			_sum += delegate::sum_sampled_data<T>(_rule,_uniform,
+					( _uniform ? 0 : seamAbscissae.data() ),seamValues.data(),
+					_bufferStart,_nextUnit,_nextUnit+1,_spacing);
+			++_nextUnit;
+		}
+	}
+
+	//the remaining complete units lie in the new chunk
+	if ( _nextUnit < numCompleteUnits ) {
+		_sum += this->sum_units(abscissae,values,numPrevious,_nextUnit,numCompleteUnits);
+		_nextUnit = numCompleteUnits;
+	}
+
+	//keep the samples of the next unit and the last four samples for finish()
+	const size_t keepFrom = std::min(this->first_sample_of_unit(_nextUnit),
+			( numTotal >= 4 ? numTotal-4 : size_t(0) ));
+	std::vector<T> bufferAbscissae, bufferValues;
+	for ( size_t i = keepFrom ; i < numTotal; ++i) {
+		if ( i < numPrevious ) {
+			bufferValues.push_back(_bufferValues[i-_bufferStart]);
+			if ( not _uniform )
+				bufferAbscissae.push_back(_bufferAbscissae[i-_bufferStart]);
+		} else {
+			bufferValues.push_back(values[i-numPrevious]);
+			if ( not _uniform )
+				bufferAbscissae.push_back(abscissae[i-numPrevious]);
+		}
+	}
+	_bufferValues.swap(bufferValues);
+	_bufferAbscissae.swap(bufferAbscissae);
+	_bufferStart = keepFrom;
+	_numSamples = numTotal;
+}
+
+template<typename T>
+T SampledDataIntegrator<T>::sum_units(T const * abscissae, T const * values,
+		size_t base, size_t unitBegin, size_t unitEnd) const {
+	//threads pay off only for large ranges
+	const size_t numThreads = gslpp::auxillary::num_threads_for_items(_numThreads,unitEnd-unitBegin);
+	if ( numThreads == 1 )
+		return delegate::sum_sampled_data<T>(_rule,_uniform,abscissae,values,base,unitBegin,unitEnd,_spacing);
+
+	//each thread sums a contiguous range. The partial sums are added in a fixed order,
+	//	such that the result does not depend on the timing of the threads.
+	std::vector<T> partialSums(numThreads,T(0));
+	gslpp::auxillary::for_each_range_in_parallel(unitBegin,unitEnd,numThreads,
+			[&] (size_t threadIndex, size_t begin, size_t end) {
+				partialSums[threadIndex] = delegate::sum_sampled_data<T>(_rule,_uniform,
+						abscissae,values,base,begin,end,_spacing);
+			});
+
+	T sum = 0;
+	for ( size_t t = 0 ; t < numThreads; ++t)
+		sum += partialSums[t];
+	return sum;
+}
+
+template<typename T>
+T SampledDataIntegrator<T>::tail_contribution() const {
+	const size_t n = _numSamples;
+	if ( n < 2 )
+		return T(0);
+
+	//the last up to four samples
+	const size_t numLast = std::min(n,size_t(4));
+	T x[4], f[4];
+	for ( size_t j = 0 ; j < numLast; ++j) {
+		const size_t i = n - numLast + j - _bufferStart;
+		f[j] = _bufferValues[i];
+		x[j] = ( _uniform ? static_cast<T>(j)*_spacing : _bufferAbscissae[i] );
+	}
+
+	if ( n == 2 ) {
+		if ( _rule == TRAPEZOID )
+			return T(0);
+		return (x[1]-x[0])*T(0.5)*(f[0]+f[1]);
+	}
+	switch ( _rule ) {
+	case SIMPSON :
+		//the last interval of an odd number of intervals
+		if ( (n-1) % 2 == 0 )
+			return T(0);
+		if ( _uniform )
+			return _spacing/T(12)*(T(5)*f[numLast-1]+T(8)*f[numLast-2]-f[numLast-3]);
+		return delegate::lagrange_integral(x+numLast-3,f+numLast-3,3,x[numLast-2],x[numLast-1]);
+	case CUBIC :
+		if ( n == 3 )
+			return delegate::lagrange_integral(x,f,3,x[0],x[2]);
+		if ( _uniform )
+			return _spacing/T(24)*(f[0]-T(5)*f[1]+T(19)*f[2]+T(9)*f[3]);
+		return delegate::lagrange_integral(x,f,4,x[2],x[3]);
+	default :
+		return T(0);
+	}
+}
+
+template<typename T>
+T SampledDataIntegrator<T>::finish() {
+	if ( not _streamActive )
+		gslpp::error_handling::Error( "Finish of an integral that has not been started",
+				gslpp::error_handling::Error::INPUT_ERROR);
+	_streamActive = false;
+	return _sum + this->tail_contribution();
+}
+
+template<typename T>
+size_t SampledDataIntegrator<T>::num_samples() const {
+	return _numSamples;
+}
+
+template<typename T>
+T SampledDataIntegrator<T>::integrate_uniform(T const * values, size_t numSamples, T spacing) {
+	this->begin_uniform(spacing);
+	this->push(values,numSamples);
+	return this->finish();
+}
+
+template<typename T>
+T SampledDataIntegrator<T>::integrate(T const * abscissae, T const * values, size_t numSamples) {
+	this->begin_nonuniform();
+	this->push(abscissae,values,numSamples);
+	return this->finish();
+}
+
+} /* namespace integration */
+} /* namespace gslpp */
@@ -0,0 +1,196 @@
+/*
+ * SplineMomentIntegrator.hpp
+ *
+ *  Created on: Oct 19, 2026
+ *      Author: alinsch
+ */
+
+#include "gslpp/integration/SplineMomentIntegrator.h"
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace gslpp {
+namespace integration {
+
+template<class Spline>
+SplineMomentIntegrator<Spline>::SplineMomentIntegrator(Spline const& spline) {
+	const size_t numSegments = spline.num_polynomials();
+	_segmentStart.reserve(numSegments);
+	_segmentLength.reserve(numSegments);
+	for ( size_t k = 0 ; k < 4; ++k)
+		_coefficients[k].reserve(numSegments);
+
+	real_type coefficients[4];
+	for ( size_t i = 0 ; i < numSegments; ++i) {
+		auto const& polynomial = spline.get_polynomial(i);
+		polynomial.power_basis_coefficients(coefficients);
+		_segmentStart.push_back(polynomial.min_range());
+		_segmentLength.push_back(polynomial.interval_length());
+		for ( size_t k = 0 ; k < 4; ++k)
+			_coefficients[k].push_back(coefficients[k]);
+	}
+}
+
+template<class Spline>
+typename SplineMomentIntegrator<Spline>::real_type
+SplineMomentIntegrator<Spline>::integral() const {
+	//the moments of t^k over [0,1] are 1/(k+1)
+	real_type result = 0;
+	for ( size_t i = 0 ; i < _segmentStart.size(); ++i)
+		result += _segmentLength[i]*(_coefficients[0][i] + _coefficients[1][i]/real_type(2)
+				+ _coefficients[2][i]/real_type(3) + _coefficients[3][i]/real_type(4));
+	return result;
+}
+
+template<class Spline>
+void SplineMomentIntegrator<Spline>::unit_fourier_moments(real_type theta,
+		std::complex<real_type> (&moments)[4]) const {
+	//moments[k] = int_0^1 exp(i theta t) t^k dt
+	const std::complex<real_type> I(0,1);
+	if ( std::fabs(theta) < real_type(1) ) {
+		//the upward recursion below cancels for small theta, sum the series
+		//	sum_j (i theta)^j / ( j! (k+j+1) ) instead.
+		for ( size_t k = 0 ; k < 4; ++k)
+			moments[k] = 0;
+		std::complex<real_type> term(1);
+		for ( size_t j = 0 ; j < 30; ++j) {
+			for ( size_t k = 0 ; k < 4; ++k)
+				moments[k] += term/static_cast<real_type>(k+j+1);
+			term *= I*theta/static_cast<real_type>(j+1);
+			if ( std::abs(term) < std::numeric_limits<real_type>::epsilon()*real_type(0.01) )
+				break;
+		}
+		return;
+	}
+	const std::complex<real_type> phase = std::polar(real_type(1),theta);
+	const std::complex<real_type> inverseITheta = -I/theta;
+	moments[0] = (phase - real_type(1))*inverseITheta;
+	for ( size_t k = 1 ; k < 4; ++k)
+		moments[k] = (phase - static_cast<real_type>(k)*moments[k-1])*inverseITheta;
+}
+
+template<class Spline>
+void SplineMomentIntegrator<Spline>::fourier_integrals(std::vector<real_type> const& omegas,
+		std::vector< std::complex<real_type> > &integrals) const {
+	const size_t segmentsBetweenPhaseUpdates = 128;
+	const real_type roundingTolerance = 8*std::numeric_limits<real_type>::epsilon();
+	integrals.resize(omegas.size());
+
+	//The frequencies are processed in blocks of fixed size. Real and imaginary parts are kept in separate
+	//	local arrays, such that the inner loop over the block has a known length, no aliasing and vectorizes.
+	const size_t blockSize = 8;
+	for ( size_t blockStart = 0 ; blockStart < omegas.size(); blockStart += blockSize) {
+		real_type omega[blockSize];
+		for ( size_t w = 0 ; w < blockSize; ++w)
+			omega[w] = ( blockStart + w < omegas.size() ? omegas[blockStart + w] : real_type(0) );
+
+		real_type phaseRe[blockSize], phaseIm[blockSize];
+		real_type stepRe[blockSize], stepIm[blockSize];
+		real_type momentsRe[4][blockSize], momentsIm[4][blockSize];
+		real_type sumRe[blockSize], sumIm[blockSize];
+		for ( size_t w = 0 ; w < blockSize; ++w) {
+			sumRe[w] = 0;
+			sumIm[w] = 0;
+		}
+
+		real_type lastSegmentLength = 0;
+		std::complex<real_type> moments[4];
+		for ( size_t i = 0 ; i < _segmentStart.size(); ++i) {
+			const real_type x0 = _segmentStart[i];
+			const real_type h = _segmentLength[i];
+			if ( i % segmentsBetweenPhaseUpdates == 0 ) {
+				for ( size_t w = 0 ; w < blockSize; ++w) {
+					phaseRe[w] = std::cos(omega[w]*x0);
+					phaseIm[w] = std::sin(omega[w]*x0);
+				}
+			}
+
+			//grids that are equidistant up to the rounding of the grid points reuse the moments. The error
+			//	is of the order of this rounding.
+			const real_type lengthTolerance = roundingTolerance*std::max(std::fabs(x0),std::fabs(x0+h));
+			if ( (i == 0) or (std::fabs(h - lastSegmentLength) > lengthTolerance) ) {
+				for ( size_t w = 0 ; w < blockSize; ++w) {
+					this->unit_fourier_moments(omega[w]*h,moments);
+					for ( size_t k = 0 ; k < 4; ++k) {
+						momentsRe[k][w] = moments[k].real();
+						momentsIm[k][w] = moments[k].imag();
+					}
+					stepRe[w] = std::cos(omega[w]*h);
+					stepIm[w] = std::sin(omega[w]*h);
+				}
+				lastSegmentLength = h;
+			}
+
+			const real_type c0 = _coefficients[0][i]*h;
+			const real_type c1 = _coefficients[1][i]*h;
+			const real_type c2 = _coefficients[2][i]*h;
+			const real_type c3 = _coefficients[3][i]*h;
+			for ( size_t w = 0 ; w < blockSize; ++w) {
+				const real_type segmentRe = c0*momentsRe[0][w] + c1*momentsRe[1][w]
+						+ c2*momentsRe[2][w] + c3*momentsRe[3][w];
+				const real_type segmentIm = c0*momentsIm[0][w] + c1*momentsIm[1][w]
+						+ c2*momentsIm[2][w] + c3*momentsIm[3][w];
+				sumRe[w] += phaseRe[w]*segmentRe - phaseIm[w]*segmentIm;
+				sumIm[w] += phaseRe[w]*segmentIm + phaseIm[w]*segmentRe;
+				const real_type nextPhaseRe = phaseRe[w]*stepRe[w] - phaseIm[w]*stepIm[w];
+				phaseIm[w] = phaseRe[w]*stepIm[w] + phaseIm[w]*stepRe[w];
+				phaseRe[w] = nextPhaseRe;
+			}
+		}
+
+		for ( size_t w = 0 ; (w < blockSize) and (blockStart + w < omegas.size()); ++w)
+			integrals[blockStart + w] = std::complex<real_type>(sumRe[w],sumIm[w]);
+	}
+}
+
+template<class Spline>
+void SplineMomentIntegrator<Spline>::power_moments(size_t maxPower, std::vector<real_type> &moments) const {
+	moments.assign(maxPower+1,real_type(0));
+	std::vector<real_type> binomial(maxPower+1);
+	std::vector<real_type> powersOfStart(maxPower+1);
+	std::vector<real_type> powersOfLength(maxPower+2);
+	for ( size_t i = 0 ; i < _segmentStart.size(); ++i) {
+		const real_type x0 = _segmentStart[i];
+		const real_type h = _segmentLength[i];
+		powersOfStart[0] = 1;
+		for ( size_t n = 1 ; n <= maxPower; ++n)
+			powersOfStart[n] = powersOfStart[n-1]*x0;
+		powersOfLength[0] = 1;
+		for ( size_t n = 1 ; n <= maxPower+1; ++n)
+			powersOfLength[n] = powersOfLength[n-1]*h;
+
+		//h int_0^1 (x0+ht)^n t^k dt = sum_j binomial(n,j) x0^(n-j) h^(j+1) / (j+k+1)
+		binomial.assign(maxPower+1,real_type(0));
+		binomial[0] = 1;
+		for ( size_t n = 0 ; n <= maxPower; ++n) {
+			if ( n > 0 )
+				for ( size_t j = n ; j > 0; --j)
+					binomial[j] += binomial[j-1];
+			real_type moment = 0;
+			for ( size_t j = 0 ; j <= n; ++j) {
+				real_type tMoments = 0;
+				for ( size_t k = 0 ; k < 4; ++k)
+					tMoments += _coefficients[k][i]/static_cast<real_type>(j+k+1);
+				moment += binomial[j]*powersOfStart[n-j]*powersOfLength[j+1]*tMoments;
+			}
+			moments[n] += moment;
+		}
+	}
+}
+
+template<class Spline>
+template<typename result_type, class KernelMoments>
+result_type SplineMomentIntegrator<Spline>::weighted_integral(KernelMoments const& kernelMoments) const {
+	result_type result = result_type(0);
+	result_type moments[4];
+	for ( size_t i = 0 ; i < _segmentStart.size(); ++i) {
+		kernelMoments(_segmentStart[i],_segmentLength[i],moments);
+		for ( size_t k = 0 ; k < 4; ++k)
+			result += moments[k]*_coefficients[k][i];
+	}
+	return result;
+}
+
+} /* namespace integration */
+} /* namespace gslpp */
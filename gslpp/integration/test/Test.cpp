@@ -21,6 +21,26 @@ void RunTest::run_test(){
 
 	test_adaptive_integration<float>();
 //	test_adaptive_integration<double>();
+
+	test_speculative_batching<double>();
+
+	test_budget_control<double>();
+	test_checkpoint_resume<double>();
+	test_breakpoint_detection<double>();
+
+	test_periodic_integration<double>();
+
+	test_iterated_integration<double>();
+
+	test_contour_integration<double>();
+
+	test_spline_moments<double>();
+
+	test_gauss_rules<double>();
+
+	test_sampled_data<double>();
+
+	test_in_place_accumulation<double>();
 };
 
 } /* namespace integration */
@@ -23,6 +23,39 @@ private:
 
 	template<typename T>
 	void test_non_adaptive_integration();
+
+	template<typename T>
+	void test_speculative_batching();
+
+	template<typename T>
+	void test_budget_control();
+
+	template<typename T>
+	void test_checkpoint_resume();
+
+	template<typename T>
+	void test_breakpoint_detection();
+
+	template<typename T>
+	void test_periodic_integration();
+
+	template<typename T>
+	void test_iterated_integration();
+
+	template<typename T>
+	void test_contour_integration();
+
+	template<typename T>
+	void test_spline_moments();
+
+	template<typename T>
+	void test_gauss_rules();
+
+	template<typename T>
+	void test_sampled_data();
+
+	template<typename T>
+	void test_in_place_accumulation();
 };
 
 } /* namespace integration */
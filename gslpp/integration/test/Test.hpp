@@ -7,10 +7,30 @@
 
 #include "gslpp/integration/test/Test.h"
 #include "gslpp/integration/Integrator.h"
+#include "gslpp/integration/PeriodicIntegrator.h"
+#include "gslpp/integration/IteratedIntegrator.h"
+#include "gslpp/integration/ContourIntegrator.h"
+#include "gslpp/integration/SplineMomentIntegrator.h"
+#include "gslpp/integration/GaussQuadratureRule.h"
+#include "gslpp/integration/SampledDataIntegrator.h"
+#include "gslpp/auxillary/MappedArray.h"
+#include "gslpp/data_interpolation/MonotoneCubeHermiteSpline.h"
 #include "gslpp/auxillary/NumAccuracyControl.h"
+#include "gslpp/float_comparison/FloatComparison.h"
 #include <cmath>
 #include <iostream>
 #include <array>
+#include <cstdio>
+#include <string>
+#include <complex>
+#include <vector>
+#include <tuple>
+#include <functional>
+#include <atomic>
+#include <thread>
+#include <limits>
+#include <memory>
+#include <fstream>
 
 namespace gslpp {
 namespace integration {
@@ -130,5 +150,713 @@ void RunTest::test_adaptive_integration(){
 	}
 }
 
+//a Lorenzian that evaluates in batches and counts the number of batches
+template<typename T>
+class BatchCountingLorenzian {
+public:
+	BatchCountingLorenzian() : _numBatches(0) { };
+
+	T operator() (T x) const {
+		const T gamma = 0.001;
+		return gamma/static_cast<T>(M_PI) / ( x*x + gamma*gamma);
+	};
+
+	void evaluate_several_points(std::vector<T> const& points, std::vector<T> &values) const {
+		++_numBatches;
+		values.clear();
+		for ( size_t i = 0 ; i < points.size(); ++i)
+			values.push_back( (*this)(points[i]) );
+	};
+
+	size_t get_num_batches() const {
+		return _numBatches;
+	};
+private:
+	mutable size_t _numBatches;
+};
+
+template<typename T>
+void RunTest::test_speculative_batching(){
+	std::cout << "\n\tTest of the speculative batch evaluation for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	BatchCountingLorenzian<T> lorenzian;
+	gslpp::auxillary::NumAccuracyControl<T> errEstim;
+	errEstim.set_global_error_threshold(1e-10,1e-10);
+
+	Integrator< BatchCountingLorenzian<T> > integrator;
+	T integral;
+	integrator.integrate(-1.0,1.0,lorenzian,integral,errEstim);
+	size_t numBatchesPlain = lorenzian.get_num_batches();
+
+	BatchCountingLorenzian<T> lorenzianSpeculative;
+	Integrator< BatchCountingLorenzian<T> > speculativeIntegrator;
+	speculativeIntegrator.set_speculative_batch_width(600);
+	T integralSpeculative;
+	speculativeIntegrator.integrate(-1.0,1.0,lorenzianSpeculative,integralSpeculative,errEstim);
+	size_t numBatchesSpeculative = lorenzianSpeculative.get_num_batches();
+
+	//the values are taken from the same function, just evaluated earlier
+	if ( integral != integralSpeculative ){
+		std::cout << "\n\tTest of the speculative batch evaluation for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Result with speculative evaluation "<< integralSpeculative <<" differs from "<< integral << std::endl;
+		_allSuccess = false;
+	}
+	if ( numBatchesSpeculative >= numBatchesPlain ){
+		std::cout << "\n\tTest of the speculative batch evaluation for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Number of batches "<< numBatchesSpeculative <<" is not below the "<< numBatchesPlain <<
+				" batches without speculative evaluation." << std::endl;
+		_allSuccess = false;
+	}
+}
+
+template<typename T>
+void RunTest::test_budget_control(){
+	std::cout << "\n\tTest of the budget control for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	//a budget of evaluations that is not sufficient for the requested accuracy
+	std::vector<size_t> numPointsEvaluated;
+	auto lorenzianFunctor = [&]( T x ){
+		const T gamma = 0.001;
+		numPointsEvaluated.push_back(1);
+		return gamma/static_cast<T>(M_PI) / ( x*x + gamma*gamma);
+	};
+	Integrator< decltype( lorenzianFunctor ) > integrator;
+	gslpp::auxillary::NumAccuracyControl<T> errEstim;
+	errEstim.set_global_error_threshold(1e-12,1e-12);
+	errEstim.set_max_num_evaluations(300);
+	T integral;
+	integrator.integrate(-1.0,1.0,lorenzianFunctor,integral,errEstim);
+	if ( (not errEstim.budget_exhausted()) or (numPointsEvaluated.size() > 300) ){
+		std::cout << "\n\tTest of the budget control for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integration with a budget of 300 evaluations used " << numPointsEvaluated.size() <<
+				" evaluations and the budget is "<< (errEstim.budget_exhausted() ? "" : "not ") << "flagged as exhausted." << std::endl;
+		_allSuccess = false;
+	}
+	const T exact = 2.0/M_PI*std::atan(1000.0);
+	if ( std::fabs(exact - integral) > std::fabs(errEstim.get_abs_error_estimate()) ){
+		std::cout << "\n\tTest of the budget control for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Error estimate "<< errEstim.get_abs_error_estimate() << " is below the actual error "
+				<< exact - integral << std::endl;
+		_allSuccess = false;
+	}
+
+	//an algorithm that is cancelled before it starts stops after the first loop
+	std::atomic<bool> cancel(true);
+	numPointsEvaluated.clear();
+	errEstim.set_max_num_evaluations(0);
+	errEstim.set_cancellation_token(&cancel);
+	integrator.integrate(-1.0,1.0,lorenzianFunctor,integral,errEstim);
+	if ( (not errEstim.budget_exhausted()) or (numPointsEvaluated.size() != 15) ){
+		std::cout << "\n\tTest of the budget control for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Cancelled integration used " << numPointsEvaluated.size() << " evaluations instead of 15." << std::endl;
+		_allSuccess = false;
+	}
+}
+
+template<typename T>
+void RunTest::test_checkpoint_resume(){
+	std::cout << "\n\tTest of checkpoint and resume for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	auto lorenzianFunctor = []( T x ){
+		const T gamma = 0.001;
+		return gamma/static_cast<T>(M_PI) / ( x*x + gamma*gamma);
+	};
+	Integrator< decltype( lorenzianFunctor ) > integrator;
+	gslpp::auxillary::NumAccuracyControl<T> errEstim;
+	errEstim.set_global_error_threshold(1e-10,1e-10);
+	T integralUninterrupted;
+	integrator.integrate(-1.0,1.0,lorenzianFunctor,integralUninterrupted,errEstim);
+
+	//interrupt the integration by an insufficient budget and continue from the checkpoint
+	const std::string fileName = "integration_checkpoint_test.bin";
+	integrator.set_checkpoint_file(fileName,2);
+	errEstim.set_max_num_evaluations(300);
+	T integral;
+	integrator.integrate(-1.0,1.0,lorenzianFunctor,integral,errEstim);
+	errEstim.set_max_num_evaluations(0);
+	integrator.set_checkpoint_file("",0);
+	integrator.resume_integration(fileName,lorenzianFunctor,integral,errEstim);
+	std::remove(fileName.c_str());
+
+	if ( errEstim.budget_exhausted() or
+			(not gslpp::float_comparison::equal_up_to_significant_digits_decimal(integral,integralUninterrupted,12)) ){
+		std::cout << "\n\tTest of checkpoint and resume for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Resumed integration gives "<< integral << " instead of " << integralUninterrupted << std::endl;
+		_allSuccess = false;
+	}
+}
+
+template<typename T>
+void RunTest::test_breakpoint_detection(){
+	std::cout << "\n\tTest of the breakpoint detection for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	//a smooth function with a jump at a position that is not reached by bisection
+	const T jumpPosition = 1.0/3.0;
+	size_t numPointsEvaluated = 0;
+	auto jumpFunctor = [&]( T x ){
+		++numPointsEvaluated;
+		return std::cos(x) + ( x > jumpPosition ? T(1) : T(0) );
+	};
+	Integrator< decltype( jumpFunctor ) > integrator;
+	gslpp::auxillary::NumAccuracyControl<T> errEstim;
+	errEstim.set_global_error_threshold(1e-10,1e-10);
+	T integral;
+	integrator.integrate(0.0,1.0,jumpFunctor,integral,errEstim);
+	const size_t numPointsBisection = numPointsEvaluated;
+
+	numPointsEvaluated = 0;
+	integrator.set_breakpoint_detection(true);
+	integrator.integrate(0.0,1.0,jumpFunctor,integral,errEstim);
+	const T exact = std::sin(T(1)) + T(1) - jumpPosition;
+	if ( (std::fabs(exact - integral) > 1e-10) or (2*numPointsEvaluated > numPointsBisection) ){
+		std::cout << "\n\tTest of the breakpoint detection for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral "<< integral << " instead of " << exact << " using "<< numPointsEvaluated <<
+				" evaluations compared to " << numPointsBisection << " with bisection only." << std::endl;
+		_allSuccess = false;
+	}
+
+	//a run that is interrupted and resumed from a checkpoint continues the detection where it stopped.
+	//	The budget stops the run between two loops when the error of the interval with the jump stalled once.
+	const size_t numPointsUninterrupted = numPointsEvaluated;
+	const std::string fileName = "integration_breakpoint_checkpoint_test.bin";
+	numPointsEvaluated = 0;
+	integrator.set_checkpoint_file(fileName,1);
+	errEstim.set_max_num_evaluations(60);
+	T integralResumed;
+	integrator.integrate(0.0,1.0,jumpFunctor,integralResumed,errEstim);
+	errEstim.set_max_num_evaluations(0);
+	integrator.set_checkpoint_file("",0);
+	integrator.resume_integration(fileName,jumpFunctor,integralResumed,errEstim);
+	std::remove(fileName.c_str());
+	if ( (std::fabs(integral - integralResumed) > 16*std::numeric_limits<T>::epsilon()*std::fabs(integral))
+			or (numPointsEvaluated != numPointsUninterrupted) ){
+		std::cout << "\n\tTest of the breakpoint detection for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Resumed integration gives "<< integralResumed << " instead of " << integral << " using "<<
+				numPointsEvaluated << " evaluations instead of " << numPointsUninterrupted << std::endl;
+		_allSuccess = false;
+	}
+}
+
+template<typename T>
+void RunTest::test_periodic_integration(){
+	std::cout << "\n\tTest of the periodic integration for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	//the integral over exp(cos(x)) is 2 pi times the modified Bessel function I_0(1)
+	size_t numPointsEvaluated = 0;
+	auto periodicFunctor = [&]( T x ){
+		++numPointsEvaluated;
+		return std::exp(std::cos(x));
+	};
+	PeriodicIntegrator< decltype( periodicFunctor ) > integrator;
+	gslpp::auxillary::NumAccuracyControl<T> errEstim;
+	errEstim.set_global_error_threshold(1e-12,1e-12);
+	T integral;
+	integrator.integrate(0.0,2.0*M_PI,periodicFunctor,integral,errEstim);
+	const T exact = 2.0*M_PI*1.2660658777520083356;
+	if ( (std::fabs(exact - integral) > 1e-12) or (numPointsEvaluated > 64) ){
+		std::cout << "\n\tTest of the periodic integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral "<< integral << " instead of " << exact << " using "<< numPointsEvaluated <<
+				" evaluations." << std::endl;
+		_allSuccess = false;
+	}
+
+	auto trigonometricFunctor = []( T x ){
+		return std::cos(3*x) + T(0.5)*std::sin(x);
+	};
+	PeriodicIntegrator< decltype( trigonometricFunctor ) > fourierIntegrator;
+	fourierIntegrator.set_initial_num_samples(16);
+	std::vector< std::complex<T> > coefficients;
+	fourierIntegrator.fourier_coefficients(0.0,2.0*M_PI,trigonometricFunctor,coefficients,errEstim);
+	const std::complex<T> expected[4] = { 0, std::complex<T>(0,-0.25), 0, 0.5 };
+	for ( size_t k = 0 ; k < 4; ++k) {
+		if ( (coefficients.size() < 4) or (std::abs(coefficients[k] - expected[k]) > 1e-12) ) {
+			std::cout << "\n\tTest of the periodic integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+					" Fourier coefficient "<< k << " is wrong." << std::endl;
+			_allSuccess = false;
+			break;
+		}
+	}
+
+	//integrators on several threads plan their transforms concurrently
+	std::vector<size_t> numWrongCoefficients(4,0);
+	std::vector<std::thread> threads;
+	for ( size_t t = 0 ; t < numWrongCoefficients.size(); ++t) {
+		threads.push_back(std::thread([&,t](){
+			PeriodicIntegrator< decltype( trigonometricFunctor ) > threadIntegrator;
+			gslpp::auxillary::NumAccuracyControl<T> threadErrEstim;
+			threadErrEstim.set_global_error_threshold(1e-12,1e-12);
+			std::vector< std::complex<T> > threadCoefficients;
+			for ( size_t i = 0 ; i < 200; ++i) {
+				threadIntegrator.set_initial_num_samples(8+t+i%5);
+				threadIntegrator.fourier_coefficients(0.0,2.0*M_PI,trigonometricFunctor,threadCoefficients,threadErrEstim);
+				for ( size_t k = 0 ; k < 4; ++k)
+					if ( (threadCoefficients.size() < 4) or (std::abs(threadCoefficients[k] - expected[k]) > 1e-12) )
+						++numWrongCoefficients[t];
+			}
+		}));
+	}
+	for ( auto &thread : threads )
+		thread.join();
+	for ( size_t t = 0 ; t < numWrongCoefficients.size(); ++t) {
+		if ( numWrongCoefficients[t] > 0 ) {
+			std::cout << "\n\tTest of the periodic integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+					" Concurrent computation of the Fourier coefficients gives "<< numWrongCoefficients[t] <<
+					" wrong coefficients on thread " << t << std::endl;
+			_allSuccess = false;
+		}
+	}
+}
+
+template<typename T>
+void RunTest::test_iterated_integration(){
+	std::cout << "\n\tTest of the iterated integration for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	//the integral of x*y^2 over [0,1]x[0,2] is 4/3. The result must not depend on the number of threads.
+	std::atomic<size_t> numPointsEvaluated(0);
+	auto functor2D = [&]( T x, T y ){
+		++numPointsEvaluated;
+		return x*y*y;
+	};
+	IteratedIntegrator< decltype( functor2D ), 0, 1 > integrator2D;
+	gslpp::auxillary::NumAccuracyControl<T> errEstim;
+	T integralSerial, integralParallel;
+	integrator2D.set_num_threads(1);
+	integrator2D.integrate(std::make_tuple(T(0),T(0)),std::make_tuple(T(1),T(2)),functor2D,integralSerial,errEstim);
+	const size_t numPointsSerial = numPointsEvaluated;
+	numPointsEvaluated = 0;
+	integrator2D.set_num_threads(4);
+	integrator2D.integrate(std::make_tuple(T(0),T(0)),std::make_tuple(T(1),T(2)),functor2D,integralParallel,errEstim);
+	if ( (std::fabs(integralSerial - T(4)/T(3)) > 1e-12) or (integralSerial != integralParallel)
+			or (numPointsSerial != numPointsEvaluated) ){
+		std::cout << "\n\tTest of the iterated integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral "<< integralSerial << " with one and "<< integralParallel << " with four threads instead of "
+				<< T(4)/T(3) << std::endl;
+		_allSuccess = false;
+	}
+
+	//the second argument is not integrated and keeps the value of the lower border, the
+	//	remaining arguments are integrated in the order z, x, y.
+	auto functor3D = []( T x, T a, T y, T z ){
+		return a*std::exp(-x-y-z);
+	};
+	IteratedIntegrator< decltype( functor3D ), 3, 0, 2 > integrator3D;
+	gslpp::auxillary::NumAccuracyControl<T> innerAcc;
+	innerAcc.set_local_error_threshold(1e-14,1e-14);
+	innerAcc.set_global_error_threshold(1e-14,1e-14);
+	integrator3D.set_accuracy_control(1,innerAcc);
+	integrator3D.set_accuracy_control(2,innerAcc);
+	T integral3D;
+	integrator3D.integrate(std::make_tuple(T(0),T(2),T(0),T(0)),std::make_tuple(T(1),T(0),T(1),T(1)),
+			functor3D,integral3D,errEstim);
+	const T exact3D = T(2)*std::pow(T(1)-std::exp(T(-1)),3);
+	if ( std::fabs(integral3D - exact3D) > 1e-12 ){
+		std::cout << "\n\tTest of the iterated integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral "<< integral3D << " instead of " << exact3D << std::endl;
+		_allSuccess = false;
+	}
+}
+
+//The function 1/z that counts the calls of the batch evaluation.
+template<typename T>
+class InverseFunction {
+public:
+	InverseFunction() : _numCalls(0) { };
+
+	std::complex<T> operator() (std::complex<T> z) const {
+		return T(1)/z;
+	}
+
+	void evaluate_several_points(std::vector< std::complex<T> > const &points,
+			std::vector< std::complex<T> > &setOfEvaluatedPoints) const {
+		++_numCalls;
+		setOfEvaluatedPoints.clear();
+		for ( auto z : points )
+			setOfEvaluatedPoints.push_back( T(1)/z );
+	}
+
+	size_t num_calls() const { return _numCalls; };
+private:
+	mutable size_t _numCalls;
+};
+
+template<typename T>
+void RunTest::test_contour_integration(){
+	std::cout << "\n\tTest of the contour integration for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	//the integral of 1/z around the origin is 2 pi i for any closed contour
+	const std::complex<T> expected(0,2.0*M_PI);
+	InverseFunction<T> inverse;
+	ContourIntegrator< InverseFunction<T> > contour;
+	contour.add_arc(std::complex<T>(0),T(1),T(0),T(M_PI));
+	contour.add_polyline({std::complex<T>(-1,0),std::complex<T>(-1,-1),std::complex<T>(1,-1),std::complex<T>(1,0)});
+	gslpp::auxillary::NumAccuracyControl< std::complex<T> > errEstim;
+	std::complex<T> integral;
+	contour.integrate(inverse,integral,errEstim);
+	if ( (std::abs(integral - expected) > 1e-10) or (contour.num_segments() != 4) ){
+		std::cout << "\n\tTest of the contour integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral "<< integral << " instead of " << expected << std::endl;
+		_allSuccess = false;
+	}
+
+	//all segments of a loop are evaluated in one batch, thus a second contour with more segments
+	//	needs no more calls than the number of refinement loops of its slowest segment.
+	const size_t numCallsFourSegments = inverse.num_calls();
+	contour.clear_contour();
+	for ( size_t k = 0 ; k < 16; ++k)
+		contour.add_arc(std::complex<T>(0),T(1),T(k)*T(M_PI)/T(8),T(k+1)*T(M_PI)/T(8));
+	InverseFunction<T> inverseManySegments;
+	contour.integrate(inverseManySegments,integral,errEstim);
+	if ( (std::abs(integral - expected) > 1e-10) or (inverseManySegments.num_calls() > numCallsFourSegments) ){
+		std::cout << "\n\tTest of the contour integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral over 16 arcs "<< integral << " instead of " << expected << " using "
+				<< inverseManySegments.num_calls() << " batches." << std::endl;
+		_allSuccess = false;
+	}
+
+	//an ellipse given as a parametrized path
+	contour.clear_contour();
+	contour.add_path([] (T t) { return std::complex<T>(2.0*std::cos(t),std::sin(t)); },
+			[] (T t) { return std::complex<T>(-2.0*std::sin(t),std::cos(t)); },
+			T(0),T(2.0*M_PI));
+	contour.integrate(inverse,integral,errEstim);
+	if ( std::abs(integral - expected) > 1e-10 ){
+		std::cout << "\n\tTest of the contour integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral over the ellipse "<< integral << " instead of " << expected << std::endl;
+		_allSuccess = false;
+	}
+}
+
+template<typename T>
+void RunTest::test_spline_moments(){
+	std::cout << "\n\tTest of the spline moments for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	//a spline on a grid with two different spacings such that the moments are recomputed
+	std::vector<T> mesh, data;
+	for ( size_t i = 0 ; i <= 300; ++i) {
+		mesh.push_back( i < 100 ? T(i)*T(0.01) : T(1) + T(i-100)*T(0.02) );
+		data.push_back( std::exp(-mesh.back())*std::sin(T(3)*mesh.back()) );
+	}
+	gslpp::data_interpolation::MonotoneCubeHermiteSpline<T> spline(mesh,data);
+	SplineMomentIntegrator< gslpp::data_interpolation::MonotoneCubeHermiteSpline<T> > moments(spline);
+
+	//compare with the adaptive integration of the spline times the weight. The breakpoints
+	//	at the grid make the integrand smooth on each interval.
+	auto spline_integral = [&] ( std::function<std::complex<T>(T)> const& weight ) {
+		auto integrand = [&] ( T x ) { return weight(x)*spline(x); };
+		Integrator< decltype( integrand ) > integrator;
+		gslpp::auxillary::NumAccuracyControl< std::complex<T> > errEstim;
+		const std::complex<T> threshold(1e-14,1e-14);
+		errEstim.set_global_error_threshold(threshold,threshold);
+		std::complex<T> integral;
+		integrator.integrate(mesh,integrand,integral,errEstim);
+		return integral;
+	};
+
+	const T integral = moments.integral();
+	const T integralExpected = spline_integral( [] (T) { return std::complex<T>(1); }).real();
+	if ( std::fabs(integral - integralExpected) > 1e-12 ){
+		std::cout << "\n\tTest of the spline moments for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral "<< integral << " instead of " << integralExpected << std::endl;
+		_allSuccess = false;
+	}
+
+	//the small frequency uses the series of the moments, the large ones the recursion.
+	const std::vector<T> omegas = { T(0), T(0.5), T(40), T(1000) };
+	std::vector< std::complex<T> > fourierIntegrals;
+	moments.fourier_integrals(omegas,fourierIntegrals);
+	for ( size_t w = 0 ; w < omegas.size(); ++w) {
+		const T omega = omegas[w];
+		const std::complex<T> expected = spline_integral(
+				[=] (T x) { return std::polar(T(1),omega*x); });
+		if ( std::abs(fourierIntegrals[w] - expected) > 1e-12 ){
+			std::cout << "\n\tTest of the spline moments for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+					" Fourier integral for omega="<< omega << " is "<< fourierIntegrals[w]
+					<< " instead of " << expected << std::endl;
+			_allSuccess = false;
+		}
+	}
+
+	std::vector<T> powerMoments;
+	moments.power_moments(3,powerMoments);
+	for ( size_t n = 0 ; n <= 3; ++n) {
+		const T expected = spline_integral( [=] (T x) { return std::complex<T>(std::pow(x,n)); }).real();
+		if ( std::fabs(powerMoments[n] - expected) > 1e-12 ){
+			std::cout << "\n\tTest of the spline moments for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+					" Power moment "<< n << " is "<< powerMoments[n] << " instead of " << expected << std::endl;
+			_allSuccess = false;
+		}
+	}
+
+	//the user hook with the moments of the weight w(x)=x, h int_0^1 (x0+ht)t^k dt
+	const T firstMoment = moments.template weighted_integral<T>( [] (T x0, T h, T (&m)[4]) {
+		for ( size_t k = 0 ; k < 4; ++k)
+			m[k] = h*(x0/T(k+1) + h/T(k+2));
+	});
+	if ( std::fabs(firstMoment - powerMoments[1]) > 1e-12 ){
+		std::cout << "\n\tTest of the spline moments for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Weighted integral "<< firstMoment << " instead of " << powerMoments[1] << std::endl;
+		_allSuccess = false;
+	}
+}
+
+template<typename T>
+void RunTest::test_gauss_rules(){
+	std::cout << "\n\tTest of the Gauss rules for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+	typedef GaussQuadratureRule<T> Rule;
+
+	//an n-point rule integrates polynomials up to degree 2n-1 exactly. The moments of the weight functions are
+	//	Legendre 2/(k+1) for even k, Laguerre k! and Hermite Gamma((k+1)/2) for even k.
+	const size_t numNodes = 12;
+	for ( int family = Rule::LEGENDRE ; family <= Rule::HERMITE; ++family) {
+		Rule rule(static_cast<typename Rule::Family>(family),numNodes);
+		for ( size_t k = 0 ; k < 2*numNodes; ++k) {
+			T moment = 0, scale = 0;
+			for ( size_t i = 0 ; i < numNodes; ++i) {
+				const T term = rule.get_weights()[i]*std::pow(rule.get_nodes()[i],static_cast<T>(k));
+				moment += term;
+				scale += std::fabs(term);
+			}
+			T expected = 0;
+			if ( family == Rule::LEGENDRE )
+				expected = ( k % 2 == 0 ? T(2)/T(k+1) : T(0) );
+			if ( family == Rule::LAGUERRE )
+				expected = std::tgamma(T(k+1));
+			if ( family == Rule::HERMITE )
+				expected = ( k % 2 == 0 ? std::tgamma(T(k+1)/T(2)) : T(0) );
+			if ( std::fabs(moment - expected) > 1e-12*scale ){
+				std::cout << "\n\tTest of the Gauss rules for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+						" Family "<< family << " moment "<< k << " is "<< moment << " instead of " << expected << std::endl;
+				_allSuccess = false;
+			}
+		}
+	}
+
+	//large rules: int_{-1}^{1} cos(100x) dx, int_0^inf exp(-x) cos(x) dx and int exp(-x^2) cos(x) dx.
+	//	The smallest weights of the Laguerre rule underflow, which the logarithmic weights resolve.
+	const size_t largeNumNodes = 20001;
+	const T expected[3] = { T(2)*std::sin(T(100))/T(100), T(0.5), std::sqrt(std::acos(T(-1)))*std::exp(T(-0.25)) };
+	for ( int family = Rule::LEGENDRE ; family <= Rule::HERMITE; ++family) {
+		std::shared_ptr<const Rule> rule = Rule::cached_rule(static_cast<typename Rule::Family>(family),largeNumNodes);
+		T integral = 0;
+		for ( size_t i = 0 ; i < largeNumNodes; ++i)
+			integral += rule->get_weights()[i]*std::cos( ( family == Rule::LEGENDRE ? T(100) : T(1) )*rule->get_nodes()[i]);
+		if ( (rule->num_nodes() != largeNumNodes) or (std::fabs(integral - expected[family]) > 1e-13) ){
+			std::cout << "\n\tTest of the Gauss rules for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+					" Family "<< family << " large rule integral "<< integral << " instead of " << expected[family] << std::endl;
+			_allSuccess = false;
+		}
+		if ( rule != Rule::cached_rule(static_cast<typename Rule::Family>(family),largeNumNodes) ){
+			std::cout << "\n\tTest of the Gauss rules for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+					" The cache returned a different rule" << std::endl;
+			_allSuccess = false;
+		}
+	}
+	//the first Legendre weight 2/((1-x^2) P_n'(x)^2) from the recurrence of the polynomials in long double.
+	//	Its relative error is not limited by the resolution of the node, which is about 1e-8 away from -1.
+	std::shared_ptr<const Rule> legendre = Rule::cached_rule(Rule::LEGENDRE,largeNumNodes);
+	long double x = legendre->get_nodes().front(), p = 0, dp = 0;
+	for ( size_t iteration = 0 ; iteration < 4; ++iteration) {
+		long double p0 = 1;
+		p = x;
+		for ( size_t k = 2 ; k <= largeNumNodes; ++k) {
+			const long double p2 = ((2*k-1)*x*p - (k-1)*p0)/k;
+			p0 = p;
+			p = p2;
+		}
+		dp = largeNumNodes*(x*p-p0)/(x*x-1);
+		x -= p/dp;
+	}
+	const long double firstWeight = 2/((1-x)*(1+x)*dp*dp);
+	if ( std::fabs(legendre->get_weights().front()-firstWeight) > 1e-10*firstWeight ){
+		std::cout << "\n\tTest of the Gauss rules for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" The first Legendre weight "<< legendre->get_weights().front() << " instead of "
+				<< static_cast<T>(firstWeight) << std::endl;
+		_allSuccess = false;
+	}
+	std::shared_ptr<const Rule> laguerre = Rule::cached_rule(Rule::LAGUERRE,largeNumNodes);
+	if ( (laguerre->get_weights().back() != T(0)) or (not (laguerre->get_log_weights().back() < std::log(std::numeric_limits<T>::min()))) ){
+		std::cout << "\n\tTest of the Gauss rules for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" The last Laguerre weight "<< laguerre->get_weights().back() << " has logarithm "
+				<< laguerre->get_log_weights().back() << std::endl;
+		_allSuccess = false;
+	}
+	Rule::clear_cache();
+
+	//the integrator with a fixed rule per segment, int_0^pi sin(x) dx = 2
+	auto sine = [] ( T x ) { return std::sin(x); };
+	Integrator< decltype( sine ) > integrator;
+	T integral;
+	integrator.gauss_legendre_integral(std::vector<T>({ T(0), T(1), std::acos(T(-1)) }),20,sine,integral);
+	if ( std::fabs(integral - T(2)) > 1e-14 ){
+		std::cout << "\n\tTest of the Gauss rules for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Gauss-Legendre integral of sin "<< integral << " instead of 2" << std::endl;
+		_allSuccess = false;
+	}
+}
+
+template<typename T>
+void RunTest::test_sampled_data(){
+	std::cout << "\n\tTest of the sampled data integration for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+	typedef SampledDataIntegrator<T> Sampled;
+
+	//each rule is exact for polynomials of its order on uniform and non-uniform grids with
+	//	even and odd numbers of intervals. The antiderivative of 1+2x-x^2+x^3/2 on [0,b].
+	auto polynomial = [] (T x, size_t order) {
+		return T(1) + T(2)*x - ( order >= 2 ? x*x : T(0) ) + ( order >= 3 ? T(0.5)*x*x*x : T(0) );
+	};
+	auto antiderivative = [] (T x, size_t order) {
+		return x + x*x - ( order >= 2 ? x*x*x/T(3) : T(0) ) + ( order >= 3 ? x*x*x*x/T(8) : T(0) );
+	};
+	const typename Sampled::Rule rules[3] = { Sampled::TRAPEZOID, Sampled::SIMPSON, Sampled::CUBIC };
+	for ( size_t order = 1 ; order <= 3; ++order) {
+		for ( size_t numSamples = 2 ; numSamples <= 9; ++numSamples) {
+			//the trapezoidal rule is exact for linear, Simpson for quadratic and the cubic rule for cubic data.
+			//	Fewer samples than the order of the rule reduce it.
+			if ( numSamples <= order )
+				continue;
+			std::vector<T> x(numSamples), f(numSamples), fUniform(numSamples);
+			for ( size_t i = 0 ; i < numSamples; ++i) {
+				x[i] = T(i) + T(0.3)*std::sin(T(i*i));
+				f[i] = polynomial(x[i],order);
+				fUniform[i] = polynomial(T(0.5)*T(i),order);
+			}
+			Sampled integrator(rules[order-1]);
+			const T nonUniform = integrator.integrate(x.data(),f.data(),numSamples);
+			const T nonUniformExpected = antiderivative(x.back(),order) - antiderivative(x.front(),order);
+			const T uniform = integrator.integrate_uniform(fUniform.data(),numSamples,T(0.5));
+			const T uniformExpected = antiderivative(T(0.5)*T(numSamples-1),order);
+			if ( (std::fabs(nonUniform - nonUniformExpected) > 1e-12*std::fabs(nonUniformExpected))
+					or (std::fabs(uniform - uniformExpected) > 1e-12*std::fabs(uniformExpected)) ){
+				std::cout << "\n\tTest of the sampled data integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+						" Rule "<< order-1 << " with "<< numSamples << " samples gives "<< nonUniform << " and " << uniform
+						<< " instead of " << nonUniformExpected << " and " << uniformExpected << std::endl;
+				_allSuccess = false;
+			}
+		}
+	}
+
+	//streaming in chunks of varying size, including chunks smaller than a stencil, and with several threads
+	const size_t numSamples = 400001;
+	const T spacing = T(1e-4);
+	std::vector<T> x(numSamples), f(numSamples);
+	for ( size_t i = 0 ; i < numSamples; ++i) {
+		x[i] = spacing*T(i);
+		f[i] = std::sin(x[i]);
+	}
+	const T expected = T(1) - std::cos(x.back());
+	for ( size_t r = 0 ; r < 3; ++r) {
+		Sampled integrator(rules[r]);
+		integrator.set_num_threads(1);
+		const T singleThread = integrator.integrate(x.data(),f.data(),numSamples);
+		integrator.set_num_threads(4);
+		const T uniform = integrator.integrate_uniform(f.data(),numSamples,spacing);
+
+		integrator.begin_nonuniform();
+		const size_t chunkSizes[5] = { 1, 2, 3, 70001, 5 };
+		for ( size_t i = 0, c = 0 ; i < numSamples; ++c) {
+			const size_t chunk = std::min(chunkSizes[c % 5],numSamples-i);
+			integrator.push(x.data()+i,f.data()+i,chunk);
+			i += chunk;
+		}
+		const T streamed = integrator.finish();
+
+		const T tolerance = ( r == 0 ? 1e-8 : 1e-13 );
+		if ( (std::fabs(singleThread - expected) > tolerance) or (std::fabs(uniform - expected) > tolerance)
+				or (std::fabs(streamed - singleThread) > 1e-13) ){
+			std::cout << "\n\tTest of the sampled data integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+					" Rule "<< r << " gives "<< singleThread << ", " << uniform << " (uniform) and " << streamed
+					<< " (streamed) instead of " << expected << std::endl;
+			_allSuccess = false;
+		}
+	}
+
+	//the samples from a memory mapped file
+	const std::string fileName = "sampled_data_test.bin";
+	{
+		std::ofstream file(fileName.c_str(),std::ios::binary);
+		file.write(reinterpret_cast<char const *>(f.data()),numSamples*sizeof(T));
+	}
+	T mapped;
+	{
+		gslpp::auxillary::MappedArray<T> values(fileName);
+		Sampled integrator(Sampled::SIMPSON);
+		mapped = ( values.size() == numSamples ?
+				integrator.integrate_uniform(values.data(),values.size(),spacing) : T(0) );
+	}
+	std::remove(fileName.c_str());
+	if ( std::fabs(mapped - expected) > 1e-13 ){
+		std::cout << "\n\tTest of the sampled data integration for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" Integral from the mapped file "<< mapped << " instead of " << expected << std::endl;
+		_allSuccess = false;
+	}
+}
+
+//a vector that counts the temporaries made by its operators
+template<typename T>
+class CountingVector : public std::vector<T> {
+public:
+	CountingVector() : std::vector<T>() { };
+
+	CountingVector(size_t n, T value) : std::vector<T>(n,value) { };
+
+	static size_t numTemporaries;
+};
+
+template<typename T>
+size_t CountingVector<T>::numTemporaries = 0;
+
+template<typename T>
+CountingVector<T> operator+ (CountingVector<T> const& a, CountingVector<T> const& b) {
+	++CountingVector<T>::numTemporaries;
+	CountingVector<T> tmp(a);
+	for ( size_t i = 0 ; i < tmp.size(); ++i)
+		tmp[i] += b[i];
+	return tmp;
+}
+template<typename T>
+CountingVector<T> operator* (CountingVector<T> const& a, T const& alpha) {
+	++CountingVector<T>::numTemporaries;
+	CountingVector<T> tmp(a);
+	for ( size_t i = 0 ; i < tmp.size(); ++i)
+		tmp[i] *= alpha;
+	return tmp;
+}
+
+template<typename T>
+void RunTest::test_in_place_accumulation(){
+	std::cout << "\n\tTest of the in place accumulation for type "<< this->nameOfTypeTrait<T>() <<":" <<std::endl;
+
+	//the moments 1, x and x^2 which the Gauss-Kronrad and Gauss-Legendre rules integrate exactly
+	auto moments = []( T x ){
+		CountingVector<T> val(3,T(1));
+		val[1] = x;
+		val[2] = x*x;
+		return val;
+	};
+	Integrator< decltype( moments ) > integrator;
+	std::vector<T> segmentPoints = { T(0), T(0.25), T(0.5), T(1) };
+	const T expected[3] = { T(1), T(0.5), T(1)/T(3) };
+
+	CountingVector<T>::numTemporaries = 0;
+	CountingVector<T> integral(3,T(0)), errorEstimation(3,T(0)), gaussIntegral(3,T(0));
+	integrator.non_adaptive_integral(segmentPoints,moments,integral,errorEstimation);
+	integrator.gauss_legendre_integral(segmentPoints,5,moments,gaussIntegral);
+	if ( CountingVector<T>::numTemporaries != 0 ){
+		std::cout << "\n\tTest of the in place accumulation for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+				" The integrator made "<< CountingVector<T>::numTemporaries << " temporaries by the operators." << std::endl;
+		_allSuccess = false;
+	}
+	for ( size_t k = 0 ; k < 3; ++k) {
+		if ( (std::fabs(integral[k] - expected[k]) > 1e-15) or (std::fabs(gaussIntegral[k] - expected[k]) > 1e-15)
+				or (std::fabs(errorEstimation[k]) > 1e-14) ){
+			std::cout << "\n\tTest of the in place accumulation for type "<< this->nameOfTypeTrait<T>() <<" failed.\n" <<
+					" Moment "<< k << " is "<< integral[k] << " (Gauss-Kronrad) and " << gaussIntegral[k]
+					<< " (Gauss-Legendre) with error estimate " << errorEstimation[k]
+					<< " instead of " << expected[k] << std::endl;
+			_allSuccess = false;
+		}
+	}
+}
+
 } /* namespace integration */
 } /* namespace gslpp */
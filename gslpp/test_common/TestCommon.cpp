@@ -6,6 +6,8 @@
  */
 
 #include "gslpp/test_common/TestCommon.h"
+#include "gslpp/extended_precision/DoubleDouble.h"
+#include "gslpp/extended_precision/QuadDouble.h"
 #include <string>
 
 namespace gslpp {
@@ -19,6 +21,14 @@ template<>
 std::string TestCommon::nameOfTypeTrait<float> () const {
 	return "float";
 }
+template<>
+std::string TestCommon::nameOfTypeTrait<gslpp::extended_precision::DoubleDouble> () const {
+	return "DoubleDouble";
+}
+template<>
+std::string TestCommon::nameOfTypeTrait<gslpp::extended_precision::QuadDouble> () const {
+	return "QuadDouble";
+}
 
 } /* namespace test_common */
 } /* namespace gslpp */